@@ -24,6 +24,9 @@
 
 #include "veins/base/connectionManager/BaseConnectionManager.h"
 
+#include <algorithm>
+#include <limits>
+
 #include "veins/base/connectionManager/NicEntryDebug.h"
 #include "veins/base/connectionManager/NicEntryDirect.h"
 #include "veins/base/modules/BaseWorldUtility.h"
@@ -59,8 +62,23 @@ double sqrTorusDist(Coord c, Coord b, Coord size)
     double zDist = dist(c.z, b.z, size.z);
     return xDist * xDist + yDist * yDist + zDist * zDist;
 }
+
+bool hasSmallerNicId(const NicEntry* a, const NicEntry* b)
+{
+    return a->nicId < b->nicId;
+}
 } // namespace
 
+const simsignal_t BaseConnectionManager::traciTimestepEndSignal = registerSignal("org_car2x_veins_modules_mobility_traciTimestepEnd");
+
+BaseConnectionManager::BaseConnectionManager()
+    : batchPositionUpdates(false)
+    , batchUpdateTrigger(nullptr)
+    , velocityAwareUpdates(false)
+    , speedBoundMargin(0)
+{
+}
+
 void BaseConnectionManager::initialize(int stage)
 {
     // BaseModule::initialize(stage);
@@ -82,6 +100,34 @@ void BaseConnectionManager::initialize(int stage)
         else
             sendDirect = false;
 
+        std::string gridTypeName = hasPar("gridType") ? par("gridType").stdstringValue() : "nested";
+        if (gridTypeName == "nested") {
+            gridType = GridType::nested;
+        }
+        else if (gridTypeName == "flat") {
+            gridType = GridType::flat;
+        }
+        else if (gridTypeName == "sparse") {
+            gridType = GridType::sparse;
+        }
+        else {
+            throw cRuntimeError("Unknown grid type \"%s\". Use \"nested\", \"flat\" or \"sparse\".", gridTypeName.c_str());
+        }
+
+        batchPositionUpdates = hasPar("batchPositionUpdates") ? par("batchPositionUpdates").boolValue() : false;
+        if (batchPositionUpdates) {
+            batchUpdateTrigger = new cMessage("batchUpdateTrigger");
+            // run after all other events of the same simulation instant
+            batchUpdateTrigger->setSchedulingPriority(SHRT_MAX);
+            getSimulation()->getSystemModule()->subscribe(traciTimestepEndSignal, this);
+        }
+
+        velocityAwareUpdates = hasPar("velocityAwareUpdates") ? par("velocityAwareUpdates").boolValue() : false;
+        speedBoundMargin = hasPar("speedBoundMargin") ? par("speedBoundMargin").doubleValue() : 0;
+        if (speedBoundMargin < 0) {
+            throw cRuntimeError("speedBoundMargin must not be negative");
+        }
+
         maxInterferenceDistance = calcInterfDist();
         maxDistSquared = maxInterferenceDistance * maxInterferenceDistance;
 
@@ -108,18 +154,29 @@ void BaseConnectionManager::initialize(int stage)
         }
 
         // step 2 - initialize the matrix which represents our grid
-        NicEntries entries;
-        RowVector row;
-        NicMatrix matrix;
-
-        for (int i = 0; i < gridDim.z; ++i) {
-            row.push_back(entries); // copy empty NicEntries to RowVector
+        if (gridType == GridType::flat) {
+            flatGrid.resize(static_cast<size_t>(gridDim.x) * gridDim.y * gridDim.z);
+            sweepCellPositions.resize(flatGrid.size(), -1);
         }
-        for (int i = 0; i < gridDim.y; ++i) { // fill the ColVector with copies of
-            matrix.push_back(row); // the RowVector.
+        else if (gridType == GridType::sparse) {
+            // cells are created on demand, index 0 stands in for all unoccupied cells
+            flatGrid.resize(1);
+            sweepCellPositions.resize(1, -1);
         }
-        for (int i = 0; i < gridDim.x; ++i) { // fill the grid with copies of
-            nicGrid.push_back(matrix); // the matrix.
+        else {
+            NicEntries entries;
+            RowVector row;
+            NicMatrix matrix;
+
+            for (int i = 0; i < gridDim.z; ++i) {
+                row.push_back(entries); // copy empty NicEntries to RowVector
+            }
+            for (int i = 0; i < gridDim.y; ++i) { // fill the ColVector with copies of
+                matrix.push_back(row); // the RowVector.
+            }
+            for (int i = 0; i < gridDim.x; ++i) { // fill the grid with copies of
+                nicGrid.push_back(matrix); // the matrix.
+            }
         }
         EV_TRACE << " using " << gridDim.x << "x" << gridDim.y << "x" << gridDim.z << " grid" << endl;
 
@@ -157,6 +214,29 @@ void BaseConnectionManager::initialize(int stage)
     }
 }
 
+void BaseConnectionManager::handleMessage(cMessage* msg)
+{
+    if (msg == batchUpdateTrigger) {
+        processPendingUpdates();
+        return;
+    }
+    throw cRuntimeError("BaseConnectionManager received unknown message \"%s\"", msg->getName());
+}
+
+void BaseConnectionManager::finish()
+{
+    if (batchPositionUpdates) {
+        getSimulation()->getSystemModule()->unsubscribe(traciTimestepEndSignal, this);
+    }
+}
+
+void BaseConnectionManager::receiveSignal(cComponent* source, simsignal_t signalID, const SimTime& t, cObject* details)
+{
+    if (signalID == traciTimestepEndSignal) {
+        processPendingUpdates();
+    }
+}
+
 BaseConnectionManager::GridCoord BaseConnectionManager::getCellForCoordinate(const Coord& c)
 {
     return GridCoord(c, findDistance);
@@ -175,6 +255,44 @@ BaseConnectionManager::NicEntries& BaseConnectionManager::getCellEntries(BaseCon
     return nicGrid[cell.x][cell.y][cell.z];
 }
 
+size_t BaseConnectionManager::getCellIndex(const BaseConnectionManager::GridCoord& cell) const
+{
+    if (gridType == GridType::sparse) {
+        auto it = sparseCellIndices.find(cell);
+        return (it == sparseCellIndices.end()) ? 0 : it->second;
+    }
+    return (static_cast<size_t>(cell.x) * gridDim.y + cell.y) * gridDim.z + cell.z;
+}
+
+void BaseConnectionManager::addNicToCell(NicEntry* nic, const GridCoord& cell)
+{
+    size_t cellIndex = getCellIndex(cell);
+    if (gridType == GridType::sparse && cellIndex == 0) {
+        if (freeCells.empty()) {
+            cellIndex = flatGrid.size();
+            flatGrid.emplace_back();
+            sweepCellPositions.push_back(-1);
+        }
+        else {
+            cellIndex = freeCells.back();
+            freeCells.pop_back();
+        }
+        sparseCellIndices.emplace(cell, cellIndex);
+    }
+    nic->gridCell = cellIndex;
+    flatGrid[cellIndex].add(nic);
+}
+
+void BaseConnectionManager::removeNicFromCell(NicEntry* nic, const GridCoord& cell)
+{
+    NicCell& nicCell = flatGrid[nic->gridCell];
+    nicCell.remove(nic->gridSlot);
+    if (gridType == GridType::sparse && nicCell.size() == 0) {
+        sparseCellIndices.erase(cell);
+        freeCells.push_back(nic->gridCell);
+    }
+}
+
 void BaseConnectionManager::registerNicExt(int nicID)
 {
     NicEntries::mapped_type nicEntry = nics[nicID];
@@ -184,8 +302,13 @@ void BaseConnectionManager::registerNicExt(int nicID)
     EV_TRACE << " registering (ext) nic at loc " << cell.info() << std::endl;
 
     // add to matrix
-    NicEntries& cellEntries = getCellEntries(cell);
-    cellEntries[nicID] = nicEntry;
+    if (usesNicCells()) {
+        addNicToCell(nicEntry, cell);
+    }
+    else {
+        NicEntries& cellEntries = getCellEntries(cell);
+        cellEntries[nicID] = nicEntry;
+    }
 }
 
 void BaseConnectionManager::checkGrid(BaseConnectionManager::GridCoord& oldCell, BaseConnectionManager::GridCoord& newCell, int id)
@@ -194,6 +317,21 @@ void BaseConnectionManager::checkGrid(BaseConnectionManager::GridCoord& oldCell,
 
     // structure to find union of grid squares
     CoordSet gridUnion(74);
+    fillUnionForMove(gridUnion, oldCell, newCell);
+
+    if (usesNicCells()) {
+        NicEntry* nic = nics.find(id)->second;
+
+        // move nic to a new position in the grid
+        moveNicInFlatGrid(nic, oldCell, newCell);
+
+        setSweepCells(gridUnion);
+        computeSweepMasks(nic);
+        for (size_t k = 0; k < sweepCells.size(); ++k) {
+            updateSweepCellConnections(nic, k);
+        }
+        return;
+    }
 
     // find nic at old position
     NicEntries& oldCellEntries = getCellEntries(oldCell);
@@ -206,6 +344,16 @@ void BaseConnectionManager::checkGrid(BaseConnectionManager::GridCoord& oldCell,
         getCellEntries(newCell)[id] = nic;
     }
 
+    GridCoord* c = gridUnion.next();
+    while (c != nullptr) {
+        EV_TRACE << "Update cons in [" << c->info() << "]" << endl;
+        updateNicConnections(getCellEntries(*c), nic);
+        c = gridUnion.next();
+    }
+}
+
+void BaseConnectionManager::fillUnionForMove(CoordSet& gridUnion, const GridCoord& oldCell, const GridCoord& newCell)
+{
     if ((gridDim.x == 1) && (gridDim.y == 1) && (gridDim.z == 1)) {
         gridUnion.add(oldCell);
     }
@@ -218,13 +366,85 @@ void BaseConnectionManager::checkGrid(BaseConnectionManager::GridCoord& oldCell,
             fillUnionWithNeighbors(gridUnion, newCell);
         }
     }
+}
+
+void BaseConnectionManager::moveNicInFlatGrid(NicEntry* nic, const GridCoord& oldCell, const GridCoord& newCell)
+{
+    if (oldCell == newCell) {
+        flatGrid[nic->gridCell].setPosition(nic->gridSlot, nic->pos);
+    }
+    else {
+        removeNicFromCell(nic, oldCell);
+        addNicToCell(nic, newCell);
+    }
+}
+
+void BaseConnectionManager::setSweepCells(CoordSet& gridUnion)
+{
+    for (auto cellIndex : sweepCells) {
+        sweepCellPositions[cellIndex] = -1;
+    }
+    sweepCells.clear();
+    sweepCoords.clear();
 
     GridCoord* c = gridUnion.next();
     while (c != nullptr) {
-        EV_TRACE << "Update cons in [" << c->info() << "]" << endl;
-        updateNicConnections(getCellEntries(*c), nic);
+        size_t cellIndex = getCellIndex(*c);
+        sweepCellPositions[cellIndex] = sweepCells.size();
+        sweepCells.push_back(cellIndex);
+        sweepCoords.push_back(*c);
         c = gridUnion.next();
     }
+
+    if (inRangeMasks.size() < sweepCells.size()) {
+        inRangeMasks.resize(sweepCells.size());
+        connectedMasks.resize(sweepCells.size());
+    }
+}
+
+void BaseConnectionManager::computeSweepMasks(const NicEntry* nic)
+{
+    const Coord& pos = nic->pos;
+
+    for (size_t k = 0; k < sweepCells.size(); ++k) {
+        const NicCell& cell = flatGrid[sweepCells[k]];
+        RangeMask& inRange = inRangeMasks[k];
+
+        if (useTorus) {
+            inRange.assign((cell.size() + 63) / 64, 0);
+            for (size_t i = 0; i < cell.size(); ++i) {
+                if (sqrTorusDist(pos, Coord(cell.x[i], cell.y[i], cell.z[i]), *playgroundSize) <= maxDistSquared) {
+                    setInRangeMask(inRange, i);
+                }
+            }
+        }
+        else {
+            computeRangeMask(pos.x, pos.y, pos.z, cell.x.data(), cell.y.data(), cell.z.data(), cell.size(), maxDistSquared, inRange);
+        }
+
+        if (nic->radioClasses != ~uint64_t(0)) {
+            for (size_t i = 0; i < cell.size(); ++i) {
+                if ((cell.radioClasses[i] & nic->radioClasses) == 0) {
+                    clearInRangeMask(inRange, i);
+                }
+            }
+        }
+
+        connectedMasks[k].assign(inRange.size(), 0);
+    }
+
+    // no recursive connections
+    int ownPosition = sweepCellPositions[nic->gridCell];
+    if (ownPosition != -1) {
+        clearInRangeMask(inRangeMasks[ownPosition], nic->gridSlot);
+    }
+
+    for (auto&& entry : nic->getGateList()) {
+        const NicEntry* other = entry.nic;
+        int position = sweepCellPositions[other->gridCell];
+        if (position == -1) continue;
+        setInRangeMask(connectedMasks[position], other->gridSlot);
+    }
 }
 
 int BaseConnectionManager::wrapIfTorus(int value, int max)
@@ -273,14 +493,19 @@ void BaseConnectionManager::fillUnionWithNeighbors(CoordSet& gridUnion, GridCoor
 }
 
 bool BaseConnectionManager::isInRange(BaseConnectionManager::NicEntries::mapped_type pFromNic, BaseConnectionManager::NicEntries::mapped_type pToNic)
+{
+    return isWithinMaxInterfDist(pFromNic->pos, pToNic->pos);
+}
+
+bool BaseConnectionManager::isWithinMaxInterfDist(const Coord& a, const Coord& b) const
 {
     double dDistance = 0.0;
 
     if (useTorus) {
-        dDistance = sqrTorusDist(pFromNic->pos, pToNic->pos, *playgroundSize);
+        dDistance = sqrTorusDist(a, b, *playgroundSize);
     }
     else {
-        dDistance = pFromNic->pos.sqrdist(pToNic->pos);
+        dDistance = a.sqrdist(b);
     }
     return (dDistance <= maxDistSquared);
 }
@@ -295,7 +520,7 @@ void BaseConnectionManager::updateNicConnections(NicEntries& nmap, BaseConnectio
         // no recursive connections
         if (nic_i->nicId == id) continue;
 
-        bool inRange = isInRange(nic, nic_i);
+        bool inRange = shareRadioClass(nic, nic_i) && isInRange(nic, nic_i);
         bool connected = nic->isConnected(nic_i);
 
         if (inRange && !connected) {
@@ -315,13 +540,162 @@ void BaseConnectionManager::updateNicConnections(NicEntries& nmap, BaseConnectio
     }
 }
 
-bool BaseConnectionManager::registerNic(cModule* nic, ChannelAccess* chAccess, Coord nicPos, Heading heading)
+void BaseConnectionManager::updateSweepCellConnections(NicEntry* nic, size_t k)
 {
+    int id = nic->nicId;
+    const NicCell& cell = flatGrid[sweepCells[k]];
+    const RangeMask& inRange = inRangeMasks[k];
+    const RangeMask& connected = connectedMasks[k];
+
+    EV_TRACE << "Update cons in [" << sweepCoords[k].info() << "]" << endl;
+
+    // collect all nics whose connection state has to change
+    changedNics.clear();
+    for (size_t w = 0; w < inRange.size(); ++w) {
+        for (uint64_t changed = inRange[w] ^ connected[w]; changed != 0; changed &= changed - 1) {
+            changedNics.push_back(cell.nics[w * 64 + lowestSetBit(changed)]);
+        }
+    }
+
+    // apply changes in the order a NicEntries map would have visited them
+    std::sort(changedNics.begin(), changedNics.end(), hasSmallerNicId);
+    for (auto nic_i : changedNics) {
+        if (isInRangeMask(inRange, nic_i->gridSlot)) {
+            EV_TRACE << "nic #" << id << " and #" << nic_i->nicId << " are in range" << endl;
+            nic->connectTo(nic_i);
+            nic_i->connectTo(nic);
+        }
+        else {
+            EV_TRACE << "nic #" << id << " and #" << nic_i->nicId << " are NOT in range" << endl;
+            nic->disconnectFrom(nic_i);
+            nic_i->disconnectFrom(nic);
+        }
+    }
+}
+
+void BaseConnectionManager::processPendingUpdates()
+{
+    if (pendingNics.empty()) return;
+
+    EV_TRACE << "processing deferred position updates of " << pendingNics.size() << " nics" << endl;
+
+    std::sort(pendingNics.begin(), pendingNics.end(), hasSmallerNicId);
+
+    // step 1 - file every nic under its new cell, so the sweeps below see final positions only
+    for (auto nic : pendingNics) {
+        GridCoord oldCell = getCellForCoordinate(nic->lastUpdatePos);
+        GridCoord newCell = getCellForCoordinate(nic->pos);
+        if (usesNicCells()) {
+            moveNicInFlatGrid(nic, oldCell, newCell);
+        }
+        else if (oldCell != newCell) {
+            getCellEntries(oldCell).erase(nic->nicId);
+            getCellEntries(newCell)[nic->nicId] = nic;
+        }
+    }
+
+    // step 2 - check every pair involving a moved nic exactly once
+    for (auto nic : pendingNics) {
+        updatePendingNicConnections(nic);
+    }
+
+    if (velocityAwareUpdates) {
+        for (auto nic : pendingNics) {
+            setConnectionsUpdated(nic);
+        }
+        for (auto nic : pendingNics) {
+            updateSafeDuration(nic);
+        }
+    }
+
+    for (auto nic : pendingNics) {
+        nic->updatePending = false;
+    }
+    pendingNics.clear();
+}
+
+void BaseConnectionManager::updatePendingNicConnections(NicEntry* nic)
+{
+    int id = nic->nicId;
+
+    // a pair with a pending nic of smaller id has been checked while processing that nic
+    auto isChecked = [id](const NicEntry* other) {
+        return other->updatePending && other->nicId < id;
+    };
+
+    changedNics.clear();
+
+    // connected nics can only go out of range
+    for (auto&& entry : nic->getGateList()) {
+        NicEntry* other = const_cast<NicEntry*>(entry.nic);
+        if (isChecked(other)) continue;
+        bool inRange = usesNicCells() ? isWithinMaxInterfDist(nic->pos, other->pos) : isInRange(nic, other);
+        if (!inRange) {
+            changedNics.push_back(other);
+        }
+    }
+
+    // nics in range are always located in the neighborhood of the new cell
+    CoordSet gridUnion(74);
+    GridCoord cell = getCellForCoordinate(nic->pos);
+    fillUnionForMove(gridUnion, cell, cell);
+    if (usesNicCells()) {
+        setSweepCells(gridUnion);
+        computeSweepMasks(nic);
+        for (size_t k = 0; k < sweepCells.size(); ++k) {
+            const NicCell& nicCell = flatGrid[sweepCells[k]];
+            const RangeMask& inRange = inRangeMasks[k];
+            const RangeMask& connected = connectedMasks[k];
+            for (size_t w = 0; w < inRange.size(); ++w) {
+                for (uint64_t unconnected = inRange[w] & ~connected[w]; unconnected != 0; unconnected &= unconnected - 1) {
+                    NicEntry* other = nicCell.nics[w * 64 + lowestSetBit(unconnected)];
+                    if (isChecked(other)) continue;
+                    changedNics.push_back(other);
+                }
+            }
+        }
+    }
+    else {
+        GridCoord* c = gridUnion.next();
+        while (c != nullptr) {
+            NicEntries& nmap = getCellEntries(*c);
+            for (NicEntries::iterator i = nmap.begin(); i != nmap.end(); ++i) {
+                NicEntry* other = i->second;
+                if (other == nic || isChecked(other)) continue;
+                if (nic->isConnected(other)) continue;
+                if (shareRadioClass(nic, other) && isInRange(nic, other)) {
+                    changedNics.push_back(other);
+                }
+            }
+            c = gridUnion.next();
+        }
+    }
+
+    for (auto other : changedNics) {
+        if (nic->isConnected(other)) {
+            EV_TRACE << "nic #" << id << " and #" << other->nicId << " are NOT in range" << endl;
+            nic->disconnectFrom(other);
+            other->disconnectFrom(nic);
+        }
+        else {
+            EV_TRACE << "nic #" << id << " and #" << other->nicId << " are in range" << endl;
+            nic->connectTo(other);
+            other->connectTo(nic);
+        }
+    }
+}
+
+bool BaseConnectionManager::registerNic(cModule* nic, ChannelAccess* chAccess, Coord nicPos, Heading heading, const std::vector<std::string>& radioClasses)
+{
+    Enter_Method_Silent();
     ASSERT(nic != nullptr);
 
     int nicID = nic->getId();
     EV_TRACE << " registering nic #" << nicID << endl;
 
+    // the new nic has to see the current grid
+    processPendingUpdates();
+
     // create new NicEntry
     NicEntries::mapped_type nicEntry;
 
@@ -337,6 +711,7 @@ bool BaseConnectionManager::registerNic(cModule* nic, ChannelAccess* chAccess, C
     nicEntry->pos = nicPos;
     nicEntry->heading = heading;
     nicEntry->chAccess = chAccess;
+    nicEntry->radioClasses = getRadioClassMask(radioClasses);
 
     // add to map
     nics[nicID] = nicEntry;
@@ -345,6 +720,11 @@ bool BaseConnectionManager::registerNic(cModule* nic, ChannelAccess* chAccess, C
 
     updateConnections(nicID, nicPos, nicPos);
 
+    if (velocityAwareUpdates) {
+        setConnectionsUpdated(nicEntry);
+        updateSafeDuration(nicEntry);
+    }
+
     if (drawMIR) {
         nic->getParentModule()->getDisplayString().setTagArg("r", 0, maxInterferenceDistance);
     }
@@ -352,14 +732,35 @@ bool BaseConnectionManager::registerNic(cModule* nic, ChannelAccess* chAccess, C
     return sendDirect;
 }
 
+uint64_t BaseConnectionManager::getRadioClassMask(const std::vector<std::string>& radioClasses)
+{
+    if (radioClasses.empty()) return ~uint64_t(0);
+
+    uint64_t mask = 0;
+    for (auto&& name : radioClasses) {
+        auto it = radioClassBits.find(name);
+        if (it == radioClassBits.end()) {
+            if (radioClassBits.size() == 64) throw cRuntimeError("Too many radio classes, at most 64 are supported");
+            int bit = radioClassBits.size();
+            it = radioClassBits.emplace(name, bit).first;
+        }
+        mask |= uint64_t(1) << it->second;
+    }
+    return mask;
+}
+
 bool BaseConnectionManager::unregisterNic(cModule* nicModule)
 {
+    Enter_Method_Silent();
     ASSERT(nicModule != nullptr);
 
     // find nicEntry
     int nicID = nicModule->getId();
     EV_TRACE << " unregistering nic #" << nicID << endl;
 
+    // the nic has to be filed under its current cell
+    processPendingUpdates();
+
     // we assume that the module was previously registered with this CM
     // TODO: maybe change this to an omnet-error instead of an assertion
     ASSERT(nics.find(nicID) != nics.end());
@@ -368,31 +769,46 @@ bool BaseConnectionManager::unregisterNic(cModule* nicModule)
     // get all affected grid squares
     CoordSet gridUnion(74);
     GridCoord cell = getCellForCoordinate(nicEntry->pos);
-    if ((gridDim.x == 1) && (gridDim.y == 1) && (gridDim.z == 1)) {
-        gridUnion.add(cell);
-    }
-    else {
-        fillUnionWithNeighbors(gridUnion, cell);
-    }
+    fillUnionForMove(gridUnion, cell, cell);
 
     // disconnect from all NICs in these grid squares
     GridCoord* c = gridUnion.next();
     while (c != nullptr) {
         EV_TRACE << "Update cons in [" << c->info() << "]" << endl;
-        NicEntries& nmap = getCellEntries(*c);
-        for (NicEntries::iterator i = nmap.begin(); i != nmap.end(); ++i) {
-            NicEntries::mapped_type other = i->second;
-            if (other == nicEntry) continue;
-            if (!other->isConnected(nicEntry)) continue;
-            other->disconnectFrom(nicEntry);
-            nicEntry->disconnectFrom(other);
+        if (usesNicCells()) {
+            changedNics.clear();
+            for (auto other : flatGrid[getCellIndex(*c)].nics) {
+                if (other == nicEntry) continue;
+                if (!other->isConnected(nicEntry)) continue;
+                changedNics.push_back(other);
+            }
+            std::sort(changedNics.begin(), changedNics.end(), hasSmallerNicId);
+            for (auto other : changedNics) {
+                other->disconnectFrom(nicEntry);
+                nicEntry->disconnectFrom(other);
+            }
+        }
+        else {
+            NicEntries& nmap = getCellEntries(*c);
+            for (NicEntries::iterator i = nmap.begin(); i != nmap.end(); ++i) {
+                NicEntries::mapped_type other = i->second;
+                if (other == nicEntry) continue;
+                if (!other->isConnected(nicEntry)) continue;
+                other->disconnectFrom(nicEntry);
+                nicEntry->disconnectFrom(other);
+            }
         }
         c = gridUnion.next();
     }
 
     // erase from grid
-    NicEntries& cellEntries = getCellEntries(cell);
-    cellEntries.erase(nicID);
+    if (usesNicCells()) {
+        removeNicFromCell(nicEntry, cell);
+    }
+    else {
+        NicEntries& cellEntries = getCellEntries(cell);
+        cellEntries.erase(nicID);
+    }
 
     // erase from list of known nics
     nics.erase(nicID);
@@ -402,28 +818,135 @@ bool BaseConnectionManager::unregisterNic(cModule* nicModule)
     return true;
 }
 
-void BaseConnectionManager::updateNicPos(int nicID, Coord newPos, Heading heading)
+void BaseConnectionManager::updateNicPos(int nicID, Coord newPos, Heading heading, Coord speed)
 {
+    Enter_Method_Silent();
     NicEntries::iterator ItNic = nics.find(nicID);
     if (ItNic == nics.end()) throw cRuntimeError("No nic with this ID (%d) is registered with this ConnectionManager.", nicID);
 
-    Coord oldPos = ItNic->second->pos;
-    ItNic->second->pos = newPos;
-    ItNic->second->heading = heading;
+    NicEntry* nic = ItNic->second;
+    nic->speed = speed;
+
+    if (velocityAwareUpdates && !nic->updatePending && !needsConnectionUpdate(nic, newPos)) {
+        // the nic stays in its cell, so only its mirrored position needs updating
+        nic->pos = newPos;
+        nic->heading = heading;
+        if (usesNicCells()) {
+            flatGrid[nic->gridCell].setPosition(nic->gridSlot, newPos);
+        }
+        return;
+    }
+
+    if (batchPositionUpdates) {
+        if (!nic->updatePending) {
+            nic->updatePending = true;
+            nic->lastUpdatePos = nic->pos;
+            pendingNics.push_back(nic);
+            if (!batchUpdateTrigger->isScheduled()) {
+                scheduleAt(simTime(), batchUpdateTrigger);
+            }
+        }
+        nic->pos = newPos;
+        nic->heading = heading;
+        return;
+    }
+
+    Coord oldPos = nic->pos;
+    nic->pos = newPos;
+    nic->heading = heading;
 
     updateConnections(nicID, oldPos, newPos);
+
+    if (velocityAwareUpdates) {
+        setConnectionsUpdated(nic);
+        updateSafeDuration(nic);
+    }
 }
 
-const NicEntry::GateList& BaseConnectionManager::getGateList(int nicID) const
+double BaseConnectionManager::getDistance(const Coord& a, const Coord& b) const
 {
+    if (useTorus) {
+        return sqrt(sqrTorusDist(a, b, *playgroundSize));
+    }
+    return a.distance(b);
+}
+
+bool BaseConnectionManager::needsConnectionUpdate(NicEntry* nic, const Coord& newPos)
+{
+    // nics entering or leaving the neighborhood are only found by a full update
+    if (getCellForCoordinate(newPos) != getCellForCoordinate(nic->pos)) return true;
+
+    double elapsed = (simTime() - nic->evalTime).dbl();
+    if (elapsed >= nic->safeDuration) return true;
+
+    // the safe duration only holds as long as the nic respects its speed bound
+    return newPos.distance(nic->evalPos) > nic->evalSpeedBound * elapsed;
+}
+
+void BaseConnectionManager::setConnectionsUpdated(NicEntry* nic)
+{
+    nic->evalPos = nic->pos;
+    nic->evalTime = simTime();
+    nic->evalSpeedBound = nic->speed.length() + speedBoundMargin;
+}
+
+void BaseConnectionManager::updateSafeDuration(NicEntry* nic)
+{
+    simtime_t now = simTime();
+    double safeDuration = std::numeric_limits<double>::infinity();
+
+    auto limitBy = [&](NicEntry* other) {
+        if (other == nic) return;
+        // the other nic may have moved since its own last update, which eats into the margin
+        double margin = std::fabs(getDistance(nic->pos, other->evalPos) - maxInterferenceDistance) - other->evalSpeedBound * (now - other->evalTime).dbl();
+        double pairSafeDuration = 0;
+        if (margin > 0) {
+            // infinite if neither nic may move
+            pairSafeDuration = margin / (nic->evalSpeedBound + other->evalSpeedBound);
+        }
+        safeDuration = std::min(safeDuration, pairSafeDuration);
+        // the pair has to be checked again as soon as either nic moves after this time
+        other->safeDuration = std::min(other->safeDuration, (now - other->evalTime).dbl() + pairSafeDuration);
+    };
+
+    // nics outside the neighborhood can only come in range after one of the pair changed its cell
+    CoordSet gridUnion(74);
+    GridCoord cell = getCellForCoordinate(nic->pos);
+    fillUnionForMove(gridUnion, cell, cell);
+    GridCoord* c = gridUnion.next();
+    while (c != nullptr) {
+        if (usesNicCells()) {
+            for (auto other : flatGrid[getCellIndex(*c)].nics) {
+                limitBy(other);
+            }
+        }
+        else {
+            for (auto&& entry : getCellEntries(*c)) {
+                limitBy(entry.second);
+            }
+        }
+        c = gridUnion.next();
+    }
+
+    nic->safeDuration = safeDuration;
+}
+
+const NicEntry::GateList& BaseConnectionManager::getGateList(int nicID)
+{
+    Enter_Method_Silent();
+    processPendingUpdates();
+
     NicEntries::const_iterator ItNic = nics.find(nicID);
     if (ItNic == nics.end()) throw cRuntimeError("No nic with this ID (%d) is registered with this ConnectionManager.", nicID);
 
     return ItNic->second->getGateList();
 }
 
-const cGate* BaseConnectionManager::getOutGateTo(const NicEntry* nic, const NicEntry* targetNic) const
+const cGate* BaseConnectionManager::getOutGateTo(const NicEntry* nic, const NicEntry* targetNic)
 {
+    Enter_Method_Silent();
+    processPendingUpdates();
+
     NicEntries::const_iterator ItNic = nics.find(nic->nicId);
     if (ItNic == nics.end()) throw cRuntimeError("No nic with this ID (%d) is registered with this ConnectionManager.", nic->nicId);
 
@@ -432,6 +955,7 @@ const cGate* BaseConnectionManager::getOutGateTo(const NicEntry* nic, const NicE
 
 BaseConnectionManager::~BaseConnectionManager()
 {
+    cancelAndDelete(batchUpdateTrigger);
     for (NicEntries::iterator ne = nics.begin(); ne != nics.end(); ne++) {
         delete ne->second;
     }
@@ -24,10 +24,13 @@
 
 #pragma once
 
+#include <unordered_map>
+
 #include "veins/veins.h"
 
 #include "veins/base/utils/AntennaPosition.h"
 #include "veins/base/connectionManager/NicEntry.h"
+#include "veins/base/connectionManager/RangeMask.h"
 #include "veins/base/utils/Heading.h"
 
 namespace veins {
@@ -45,12 +48,30 @@ class ChannelAccess;
  * You may not instantiate BaseConnectionManager!
  * Use ConnectionManager instead.
  *
+ * If batchPositionUpdates is set, position updates are only recorded and
+ * the connections of all moved nics are updated in a single pass at the
+ * end of the simulation instant (or at the end of a TraCI timestep, or
+ * whenever connections are queried, whichever comes first). Every pair of
+ * nics is then checked at most once per pass.
+ *
+ * If velocityAwareUpdates is set, the connections of a nic are only updated
+ * when they may have changed: every full update derives, from the distances
+ * to all nearby nics and bounds of their speeds, a time during which no pair
+ * involving the nic can cross maxInterferenceDistance. Position updates of a
+ * nic that stays within its cell, within its speed bound and within this
+ * time only move the nic.
+ *
+ * Nics can be assigned radio classes (e.g., frequency bands or radio
+ * technologies). All nics share the same grid, but two nics only get
+ * connected if they have at least one radio class in common. Nics without
+ * any radio class belong to all of them.
+ *
  * @ingroup connectionManager
  * @author Steffen Sroka, Daniel Willkomm, Karl Wessel
  * @author Christoph Sommer ("unregisterNic()"-method)
  * @sa ChannelAccess
  */
-class VEINS_API BaseConnectionManager : public cSimpleModule {
+class VEINS_API BaseConnectionManager : public cSimpleModule, public cListener {
 private:
     /**
      * @brief Represents a position inside a grid.
@@ -137,6 +158,14 @@ private:
         }
     };
 
+    /** @brief Hash function for GridCoords.*/
+    struct VEINS_API GridCoordHash {
+        size_t operator()(const GridCoord& c) const
+        {
+            return (static_cast<size_t>(c.x) * 73856093) ^ (static_cast<size_t>(c.y) * 19349663) ^ (static_cast<size_t>(c.z) * 83492791);
+        }
+    };
+
     /**
      * @brief Represents an minimalistic (hash)set of GridCoords.
      *
@@ -145,7 +174,9 @@ private:
     class VEINS_API CoordSet {
     protected:
         /** @brief Holds the hash table.*/
-        std::vector<GridCoord*> data;
+        std::vector<GridCoord> data;
+        /** @brief Marks the occupied entries of the hash table.*/
+        std::vector<bool> used;
         /** @brief maximum size of the hash table.*/
         unsigned maxSize;
         /** @brief Current number of entries in the hash table.*/
@@ -164,12 +195,13 @@ private:
          */
         void insert(const GridCoord& c, unsigned pos)
         {
-            if (data[pos] == nullptr) {
-                data[pos] = new GridCoord(c);
+            if (!used[pos]) {
+                data[pos] = c;
+                used[pos] = true;
                 size++;
             }
             else {
-                if (*data[pos] != c) {
+                if (data[pos] != c) {
                     insert(c, (pos + 2) % maxSize);
                 }
             }
@@ -185,18 +217,7 @@ private:
             , current(0)
         {
             data.resize(maxSize);
-        }
-
-        /**
-         * @brief Delete every created GridCoord
-         */
-        ~CoordSet()
-        {
-            for (unsigned i = 0; i < maxSize; i++) {
-                if (data[i] != nullptr) {
-                    delete data[i];
-                }
-            }
+            used.resize(maxSize, false);
         }
 
         /**
@@ -217,8 +238,8 @@ private:
         GridCoord* next()
         {
             for (; current < maxSize; current++) {
-                if (data[current] != nullptr) {
-                    return data[current++];
+                if (used[current]) {
+                    return &data[current++];
                 }
             }
             return nullptr;
@@ -243,7 +264,94 @@ private:
         }
     };
 
+    /**
+     * @brief Stores the nics of one grid cell as structure-of-arrays.
+     *
+     * Internal helper class of BaseConnectionManager used by the flat and
+     * the sparse grid.
+     * The position of every nic is mirrored into separate contiguous arrays,
+     * so that sweeping a cell for neighbors touches only contiguous memory.
+     * Removing a nic moves the last nic of the cell into the freed slot, so
+     * nics are not stored in any particular order.
+     */
+    class VEINS_API NicCell {
+    public:
+        /** @brief NicEntries stored in this cell.*/
+        std::vector<NicEntry*> nics;
+        /** @brief Ids of the nics stored in this cell.*/
+        std::vector<int> ids;
+        /** @brief Radio classes of the nics stored in this cell.*/
+        std::vector<uint64_t> radioClasses;
+        /** @brief Position components of the nics stored in this cell.*/
+        /*@{*/
+        std::vector<double> x;
+        std::vector<double> y;
+        std::vector<double> z;
+        /*@}*/
+
+    public:
+        /** @brief Returns the number of nics stored in this cell.*/
+        size_t size() const
+        {
+            return nics.size();
+        }
+
+        /**
+         * @brief Appends a nic to this cell and stores its slot in the
+         * NicEntry.
+         */
+        void add(NicEntry* nic)
+        {
+            nic->gridSlot = nics.size();
+            nics.push_back(nic);
+            ids.push_back(nic->nicId);
+            radioClasses.push_back(nic->radioClasses);
+            x.push_back(nic->pos.x);
+            y.push_back(nic->pos.y);
+            z.push_back(nic->pos.z);
+        }
+
+        /**
+         * @brief Removes the nic in the given slot by moving the last nic
+         * of this cell into it.
+         */
+        void remove(size_t slot)
+        {
+            size_t last = nics.size() - 1;
+            if (slot != last) {
+                nics[slot] = nics[last];
+                ids[slot] = ids[last];
+                radioClasses[slot] = radioClasses[last];
+                x[slot] = x[last];
+                y[slot] = y[last];
+                z[slot] = z[last];
+                nics[slot]->gridSlot = slot;
+            }
+            nics.pop_back();
+            ids.pop_back();
+            radioClasses.pop_back();
+            x.pop_back();
+            y.pop_back();
+            z.pop_back();
+        }
+
+        /** @brief Updates the stored position of the nic in the given slot.*/
+        void setPosition(size_t slot, const Coord& pos)
+        {
+            x[slot] = pos.x;
+            y[slot] = pos.y;
+            z[slot] = pos.z;
+        }
+    };
+
 protected:
+    /** @brief Storage backends for the grid of nics.*/
+    enum class GridType {
+        nested, ///< one map of NicEntries per cell in a 3-dimensional vector
+        flat, ///< one NicCell per cell in a single contiguous vector
+        sparse ///< one NicCell per occupied cell, found via a hash map
+    };
+
     /** @brief Type for map from nic-module id to nic-module pointer.*/
     typedef std::map<int, NicEntry*> NicEntries;
 
@@ -298,6 +406,64 @@ protected:
     /** @brief The size of the grid */
     GridCoord gridDim;
 
+    /** @brief Storage backend used for the grid of nics */
+    GridType gridType;
+
+    /**
+     * @brief Register of all nics used by the flat and the sparse grid
+     *
+     * Indexed by getCellIndex(). The flat grid holds gridDim.x * gridDim.y *
+     * gridDim.z cells. The sparse grid holds an empty cell at index 0 that
+     * stands in for all unoccupied cells, followed by a pool of cells that
+     * are (re)used for occupied cells only.
+     */
+    std::vector<NicCell> flatGrid;
+
+    /** @brief Index in flatGrid of every occupied cell of the sparse grid */
+    std::unordered_map<GridCoord, size_t, GridCoordHash> sparseCellIndices;
+
+    /** @brief Unused cells of the pool of the sparse grid */
+    std::vector<size_t> freeCells;
+
+    /** @brief Scratch buffer for nics whose connection state changes.*/
+    std::vector<NicEntry*> changedNics;
+
+    /** @brief Flat grid cells to sweep for the nic currently updated, in CoordSet order.*/
+    std::vector<size_t> sweepCells;
+
+    /** @brief Coordinates of the cells in sweepCells.*/
+    std::vector<GridCoord> sweepCoords;
+
+    /** @brief Position of every cell of flatGrid in sweepCells, or -1.*/
+    std::vector<int> sweepCellPositions;
+
+    /** @brief For every cell in sweepCells, the nics in range of the nic currently updated.*/
+    std::vector<RangeMask> inRangeMasks;
+
+    /** @brief For every cell in sweepCells, the nics connected to the nic currently updated.*/
+    std::vector<RangeMask> connectedMasks;
+
+    /** @brief Defer connection updates to one batched pass per simulation instant */
+    bool batchPositionUpdates;
+
+    /** @brief Nics whose position changed since the last batched pass */
+    std::vector<NicEntry*> pendingNics;
+
+    /** @brief Self message triggering the batched pass at the end of the current simulation instant */
+    cMessage* batchUpdateTrigger;
+
+    /** @brief Signal emitted by TraCIScenarioManager after every timestep (subscribed to by name) */
+    static const simsignal_t traciTimestepEndSignal;
+
+    /** @brief Bit assigned to each radio class name, in order of first use */
+    std::map<std::string, int> radioClassBits;
+
+    /** @brief Skip connection updates of nics whose connections cannot have changed */
+    bool velocityAwareUpdates;
+
+    /** @brief Added to the current speed of a nic to bound its speed until its next connection update [m/s] */
+    double speedBoundMargin;
+
 private:
     /** @brief Manages the connections of a registered nic. */
     void updateNicConnections(NicEntries& nmap, NicEntries::mapped_type nic);
@@ -318,6 +484,114 @@ private:
      */
     NicEntries& getCellEntries(GridCoord& cell);
 
+    /** @brief Whether two nics have at least one radio class in common.*/
+    static bool shareRadioClass(const NicEntry* a, const NicEntry* b)
+    {
+        return (a->radioClasses & b->radioClasses) != 0;
+    }
+
+    /**
+     * @brief Checks the default distance criterion between two positions.
+     */
+    bool isWithinMaxInterfDist(const Coord& a, const Coord& b) const;
+
+    /**
+     * @brief Updates the connections of a nic whose position update was
+     * deferred.
+     *
+     * Disconnects connected nics that are out of range and connects nics in
+     * the neighborhood of the new cell that are in range. Pairs with a
+     * pending nic of smaller id are skipped, they have already been checked.
+     */
+    void updatePendingNicConnections(NicEntry* nic);
+
+    /** @brief Whether nics are stored in NicCells (flat or sparse grid).*/
+    bool usesNicCells() const
+    {
+        return gridType != GridType::nested;
+    }
+
+    /**
+     * @brief Returns the index of a cell in flatGrid.
+     *
+     * For the sparse grid, unoccupied cells yield the (empty) cell 0.
+     */
+    size_t getCellIndex(const GridCoord& cell) const;
+
+    /** @brief Adds a nic to a cell, occupying the cell if necessary.*/
+    void addNicToCell(NicEntry* nic, const GridCoord& cell);
+
+    /** @brief Removes a nic from its cell, releasing the cell once it is empty.*/
+    void removeNicFromCell(NicEntry* nic, const GridCoord& cell);
+
+    /**
+     * @brief Sets the cells of flatGrid to sweep, in the order of
+     * the given CoordSet.
+     */
+    void setSweepCells(CoordSet& gridUnion);
+
+    /**
+     * @brief Computes inRangeMasks and connectedMasks of a nic for all
+     * cells in sweepCells.
+     *
+     * Range checks use the vectorized computeRangeMask() and exclude nics
+     * without a radio class in common; connections are
+     * read by walking the gate list of the nic once instead of looking up
+     * every candidate.
+     */
+    void computeSweepMasks(const NicEntry* nic);
+
+    /**
+     * @brief Manages the connections of a registered nic to the nics
+     * stored in the k-th cell of sweepCells.
+     *
+     * Requires computeSweepMasks() to have been called for the nic.
+     * Produces the same connects and disconnects, in the same order, as
+     * updateNicConnections() does for the nested grid.
+     */
+    void updateSweepCellConnections(NicEntry* nic, size_t k);
+
+    /**
+     * @brief Moves a nic from oldCell to newCell of flatGrid and
+     * updates its mirrored position.
+     */
+    void moveNicInFlatGrid(NicEntry* nic, const GridCoord& oldCell, const GridCoord& newCell);
+
+    /**
+     * @brief Adds the cells whose connections to a nic at oldCell (now
+     * at newCell) have to be checked to a union of coords.
+     */
+    void fillUnionForMove(CoordSet& gridUnion, const GridCoord& oldCell, const GridCoord& newCell);
+
+    /** @brief Returns the (torus-aware) distance between two positions.*/
+    double getDistance(const Coord& a, const Coord& b) const;
+
+    /**
+     * @brief Checks whether moving a nic to newPos may change its
+     * connections.
+     *
+     * This is the case if the nic changes its cell, if it moved faster than
+     * the speed bound of its last connection update, or if the safe duration
+     * of its last connection update has expired.
+     */
+    bool needsConnectionUpdate(NicEntry* nic, const Coord& newPos);
+
+    /** @brief Records position, time and speed bound of a connection update of a nic.*/
+    void setConnectionsUpdated(NicEntry* nic);
+
+    /**
+     * @brief Computes the time during which no connection of a nic can
+     * change.
+     *
+     * For every nic in the neighborhood, the distance to the interference
+     * threshold (less the distance the other nic may have moved since its
+     * own last update) is divided by the sum of both speed bounds. The safe
+     * duration of the other nic is shortened to the same pair bound. Requires
+     * setConnectionsUpdated() to have been called for all nics updated in the
+     * same pass.
+     */
+    void updateSafeDuration(NicEntry* nic);
+
     /**
      * If the value is outside of its bounds (zero and max) this function
      * returns -1 if useTorus is false and the wrapped value if useTorus is true.
@@ -377,6 +651,11 @@ protected:
      * This function will be used to decide if two nic's shall be connected or not. It
      * is simple to overload this function to enhance the decision for connection or not.
      *
+     * Note that the flat and sparse grids evaluate the distance criterion on its mirrored
+     * positions directly; overloads of this function are only honored by the
+     * nested grid, and velocity-aware updates assume a criterion that only
+     * depends on the distance between nics.
+     *
      * @param pFromNic Nic source point which should be checked.
      * @param pToNic   Nic target point which should be checked.
      * @return true if the nic's are in range and can be connected, false if not.
@@ -384,6 +663,7 @@ protected:
     virtual bool isInRange(NicEntries::mapped_type pFromNic, NicEntries::mapped_type pToNic);
 
 public:
+    BaseConnectionManager();
     ~BaseConnectionManager() override;
 
     /** @brief Needs two initialization stages.*/
@@ -398,13 +678,46 @@ public:
      **/
     void initialize(int stage) override;
 
+    /** @brief Handles the end-of-instant trigger of batched position updates.*/
+    void handleMessage(cMessage* msg) override;
+
+    void finish() override;
+
+    void finish(cComponent* component, simsignal_t signalID) override
+    {
+        cListener::finish(component, signalID);
+    }
+
+    using cListener::receiveSignal;
+    /** @brief Runs the batched pass at the end of every TraCI timestep.*/
+    void receiveSignal(cComponent* source, simsignal_t signalID, const SimTime& t, cObject* details) override;
+
+    /**
+     * @brief Updates the connections of all nics whose position update was
+     * deferred.
+     *
+     * Does nothing unless batchPositionUpdates is set.
+     */
+    void processPendingUpdates();
+
     /**
      * @brief Registers a nic to have its connections managed by ConnectionManager.
      *
      * If you want to do your own stuff at the registration of a nic see
      * "registerNicExt()".
+     *
+     * The nic is only connected to nics sharing one of radioClasses (or to
+     * all nics in range, if radioClasses is empty).
+     */
+    bool registerNic(cModule* nic, ChannelAccess* chAccess, Coord nicPos, Heading heading, const std::vector<std::string>& radioClasses = std::vector<std::string>());
+
+    /**
+     * @brief Returns the bitmask of a set of radio class names.
+     *
+     * Every distinct name is assigned its own bit, at most 64 names are
+     * supported. An empty set yields the mask of all radio classes.
      */
-    bool registerNic(cModule* nic, ChannelAccess* chAccess, Coord nicPos, Heading heading);
+    uint64_t getRadioClassMask(const std::vector<std::string>& radioClasses);
 
     /**
      * @brief Unregisters a NIC such that its connections aren't managed by the CM
@@ -420,14 +733,14 @@ public:
      */
     bool unregisterNic(cModule* nic);
 
-    /** @brief Updates the position information of a registered nic.*/
-    void updateNicPos(int nicID, Coord newPos, Heading heading);
+    /** @brief Updates the position information (and current speed) of a registered nic.*/
+    void updateNicPos(int nicID, Coord newPos, Heading heading, Coord speed = Coord());
 
     /** @brief Returns the ingates of all nics in range*/
-    const NicEntry::GateList& getGateList(int nicID) const;
+    const NicEntry::GateList& getGateList(int nicID);
 
     /** @brief Returns the ingate of the with id==targetID, or 0 if not in range*/
-    const cGate* getOutGateTo(const NicEntry* nic, const NicEntry* targetNic) const;
+    const cGate* getOutGateTo(const NicEntry* nic, const NicEntry* targetNic);
 };
 
 } // namespace veins
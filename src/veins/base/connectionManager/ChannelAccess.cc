@@ -69,6 +69,10 @@ void ChannelAccess::initialize(int stage)
             antennaOffsetYaw = par("antennaOffsetYaw").doubleValue();
         }
 
+        if (hasPar("radioClasses")) {
+            radioClasses = cStringTokenizer(par("radioClasses").stringValue()).asVector();
+        }
+
         findHost()->subscribe(BaseMobility::mobilityStateChangedSignal, this);
 
         cModule* nic = getParentModule();
@@ -80,15 +84,30 @@ void ChannelAccess::initialize(int stage)
     usePropagationDelay = par("usePropagationDelay");
 }
 
-void ChannelAccess::sendToChannel(cPacket* msg)
+void ChannelAccess::sendToChannel(cPacket* msg, double maxDistance)
 {
     EV_TRACE << "sendToChannel: sending to gates\n";
 
     const auto& gateList = cc->getGateList(getParentModule()->getId());
 
+    bool checkDistance = maxDistance < std::numeric_limits<double>::infinity();
+    Coord senderPos = antennaPosition.getPositionAt();
+    double maxSqrDistance = maxDistance * maxDistance;
+
     for (auto&& entry : gateList) {
-        const auto gate = entry.second;
-        const auto propagationDelay = calculatePropagationDelay(entry.first);
+        if (checkDistance || preFilterReceivers) {
+            Coord receiverPos = entry.chAccess->antennaPosition.getPositionAt();
+            double sqrDistance = world->useTorus() ? receiverPos.sqrTorusDist(senderPos, *world->getPgs()) : receiverPos.sqrdist(senderPos);
+            if (sqrDistance > maxSqrDistance) continue;
+            if (preFilterReceivers && isNegligibleAt(msg, entry.chAccess, sqrt(sqrDistance))) {
+                EV_TRACE << "sendToChannel: skipping " << entry.chAccess->getFullPath() << ", message would arrive too weak\n";
+                suppressedDeliveries++;
+                continue;
+            }
+        }
+
+        const auto gate = entry.gate;
+        const auto propagationDelay = calculatePropagationDelay(entry.chAccess);
 
         if (useSendDirect) {
             if (gate->isVector()) {
@@ -109,11 +128,15 @@ void ChannelAccess::sendToChannel(cPacket* msg)
 }
 
 simtime_t ChannelAccess::calculatePropagationDelay(const NicEntry* nic)
+{
+    return calculatePropagationDelay(nic->chAccess);
+}
+
+simtime_t ChannelAccess::calculatePropagationDelay(const ChannelAccess* receiverModule)
 {
     if (!usePropagationDelay) return 0;
 
-    ChannelAccess* const senderModule = this;
-    ChannelAccess* const receiverModule = nic->chAccess;
+    const ChannelAccess* const senderModule = this;
     // const simtime_t_cref sStart         = simTime();
 
     ASSERT(senderModule);
@@ -137,12 +160,12 @@ void ChannelAccess::receiveSignal(cComponent* source, simsignal_t signalID, cObj
         antennaHeading = Heading(heading.getRad() + antennaOffsetYaw);
 
         if (isRegistered) {
-            cc->updateNicPos(getParentModule()->getId(), antennaPosition.getPositionAt(), antennaHeading);
+            cc->updateNicPos(getParentModule()->getId(), antennaPosition.getPositionAt(), antennaHeading, mobility->getCurrentSpeed());
         }
         else {
             // register the nic with ConnectionManager
             // returns true, if sendDirect is used
-            useSendDirect = cc->registerNic(getParentModule(), this, antennaPosition.getPositionAt(), antennaHeading);
+            useSendDirect = cc->registerNic(getParentModule(), this, antennaPosition.getPositionAt(), antennaHeading, radioClasses);
             isRegistered = true;
         }
     }
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <limits>
 #include <vector>
 
 #include "veins/veins.h"
@@ -90,12 +91,26 @@ protected:
     /** @brief Offset of antenna orientation (yaw, in rad) with respect to what a BaseMobility module will tell us */
     double antennaOffsetYaw = 0;
 
+    /** @brief Radio classes (e.g., frequency bands) this nic uses, empty if it can reach all nics */
+    std::vector<std::string> radioClasses;
+
+    /** @brief Whether sendToChannel() asks isNegligibleAt() before delivering a message to a nic */
+    bool preFilterReceivers = false;
+
+    /** @brief Number of deliveries sendToChannel() skipped because isNegligibleAt() held */
+    long suppressedDeliveries = 0;
+
 protected:
     /**
      * @brief Calculates the propagation delay to the passed receiving nic.
      */
     simtime_t calculatePropagationDelay(const NicEntry* nic);
 
+    /**
+     * @brief Calculates the propagation delay to the passed receiving ChannelAccess module.
+     */
+    simtime_t calculatePropagationDelay(const ChannelAccess* receiverModule);
+
     /** @brief Sends a message to all nics connected to this one.
      *
      * This function has to be called whenever a packet is supposed to be
@@ -104,8 +119,23 @@ protected:
      *
      * depending on which ConnectionManager module is used, the messages are
      * send via sendDirect() or to the respective gates.
+     *
+     * Connected nics farther away than maxDistance are skipped, as are
+     * nics for which isNegligibleAt() holds if preFilterReceivers is set.
      **/
-    void sendToChannel(cPacket* msg);
+    void sendToChannel(cPacket* msg, double maxDistance = std::numeric_limits<double>::infinity());
+
+    /**
+     * @brief Returns whether msg provably arrives at the passed receiver,
+     * distance meters away, too weak to have any effect there.
+     *
+     * Only called by sendToChannel() if preFilterReceivers is set.
+     * Must be conservative: the default never rejects a delivery.
+     */
+    virtual bool isNegligibleAt(cPacket* msg, ChannelAccess* receiver, double distance)
+    {
+        return false;
+    }
 
 public:
     /**
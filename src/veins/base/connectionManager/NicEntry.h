@@ -27,7 +27,8 @@
 
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <vector>
 
 #include "veins/veins.h"
 
@@ -48,18 +49,94 @@ class ChannelAccess;
  * @sa ConnectionManager
  */
 class VEINS_API NicEntry : public HasLogProxy {
-protected:
-    class VEINS_API NicEntryComparator {
+public:
+    /**
+     * @brief Outgoing connections of a nic.
+     *
+     * Stores one entry per connected nic in a contiguous vector, sorted
+     * by the id of the connected nic. Iterating visits connected nics in
+     * order of their id, lookups are binary searches.
+     */
+    class VEINS_API GateList {
     public:
-        bool operator()(const NicEntry* nic1, const NicEntry* nic2) const
+        /** @brief Connection to one other nic */
+        struct Entry {
+            /** @brief module id of the connected nic*/
+            int nicId;
+            /** @brief the connected nic*/
+            const NicEntry* nic;
+            /** @brief the gate to send the msg to*/
+            cGate* gate;
+            /** @brief ChannelAccess module of the connected nic*/
+            ChannelAccess* chAccess;
+        };
+
+        using const_iterator = std::vector<Entry>::const_iterator;
+
+    protected:
+        std::vector<Entry> entries;
+
+    public:
+        const_iterator begin() const
         {
-            return nic1->nicId < nic2->nicId;
+            return entries.begin();
         }
-    };
 
-public:
-    /** @brief Type for map from NicEntry pointer to a gate.*/
-    typedef std::map<const NicEntry*, cGate*, NicEntryComparator> GateList;
+        const_iterator end() const
+        {
+            return entries.end();
+        }
+
+        size_t size() const
+        {
+            return entries.size();
+        }
+
+        bool empty() const
+        {
+            return entries.empty();
+        }
+
+        /** @brief Returns the entry of the connection to nic, or end() if not connected */
+        const_iterator find(const NicEntry* nic) const
+        {
+            auto it = lowerBound(nic->nicId);
+            if (it != entries.end() && it->nicId == nic->nicId) return it;
+            return entries.end();
+        }
+
+        /** @brief Adds (or replaces) the connection to nic */
+        void insert(const NicEntry* nic, cGate* gate)
+        {
+            auto it = entries.begin() + (lowerBound(nic->nicId) - entries.begin());
+            if (it != entries.end() && it->nicId == nic->nicId) {
+                it->gate = gate;
+                return;
+            }
+            entries.insert(it, {nic->nicId, nic, gate, nic->chAccess});
+        }
+
+        /** @brief Removes the connection pointed to by it */
+        void erase(const_iterator it)
+        {
+            entries.erase(entries.begin() + (it - entries.begin()));
+        }
+
+        /** @brief Removes the connection to nic, if any */
+        void erase(const NicEntry* nic)
+        {
+            auto it = find(nic);
+            if (it != entries.end()) erase(it);
+        }
+
+    protected:
+        const_iterator lowerBound(int nicId) const
+        {
+            return std::lower_bound(entries.begin(), entries.end(), nicId, [](const Entry& entry, int id) {
+                return entry.nicId < id;
+            });
+        }
+    };
 
     /** @brief module id of the nic for which information is stored*/
     int nicId;
@@ -79,13 +156,41 @@ public:
     /** @brief Points to this nics ChannelAccess module */
     ChannelAccess* chAccess;
 
+    /** @brief Index of the cell of a flat grid this nic is stored in */
+    size_t gridCell;
+
+    /** @brief Slot of this nic inside its cell of a flat grid */
+    size_t gridSlot;
+
+    /** @brief Whether a deferred position update awaits the next batched pass */
+    bool updatePending;
+
+    /** @brief Position the connections were last updated for (only valid while updatePending) */
+    Coord lastUpdatePos;
+
+    /** @brief Bitmask of the radio classes of the nic (see BaseConnectionManager::getRadioClassMask()) */
+    uint64_t radioClasses;
+
+    /** @brief Current speed of the nic */
+    Coord speed;
+
+    /** @name State of the last full connection update, used by velocity-aware updates */
+    /*@{*/
+    Coord evalPos;
+    simtime_t evalTime;
+    /** @brief Assumed upper bound of the speed of the nic until its next full update [m/s] */
+    double evalSpeedBound;
+    /** @brief Time after evalTime during which the connections of this nic cannot change [s] */
+    double safeDuration;
+    /*@}*/
+
 protected:
     /** @brief Outgoing connections of this nic
      *
-     * This map stores all connection for this nic to other nics
+     * This list stores all connection for this nic to other nics
      *
-     * The first entry is the module id of the nic the connection is
-     * going to and the second the gate to send the msg to
+     * Every entry holds the nic the connection is going to and the gate
+     * to send the msg to
      **/
     GateList outConns;
 
@@ -97,7 +202,14 @@ public:
         : HasLogProxy(owner)
         , nicId(0)
         , nicPtr(nullptr)
-        , hostId(0){};
+        , hostId(0)
+        , chAccess(nullptr)
+        , gridCell(0)
+        , gridSlot(0)
+        , updatePending(false)
+        , radioClasses(~uint64_t(0))
+        , evalSpeedBound(0)
+        , safeDuration(0){};
 
     /**
      * @brief Destructor -- needs to be there...
@@ -113,13 +225,13 @@ public:
     virtual void disconnectFrom(NicEntry*) = 0;
 
     /** @brief return the actual gateList*/
-    const GateList& getGateList()
+    const GateList& getGateList() const
     {
         return outConns;
     }
 
     /** @brief Checks if this nic is connected to the "other" nic*/
-    bool isConnected(const NicEntry* other)
+    bool isConnected(const NicEntry* other) const
     {
         return (outConns.find(other) != outConns.end());
     };
@@ -132,9 +244,10 @@ public:
      *
      * @param to pointer to the NicEntry to which the packet is about to be sent
      */
-    const cGate* getOutGateTo(const NicEntry* to)
+    const cGate* getOutGateTo(const NicEntry* to) const
     {
-        return outConns[to];
+        auto it = outConns.find(to);
+        return (it != outConns.end()) ? it->gate : nullptr;
     };
 };
 
@@ -40,7 +40,7 @@ void NicEntryDirect::connectTo(NicEntry* other)
     cGate* radioGate = nullptr;
     if ((radioGate = otherPtr->gate("radioIn")) == nullptr) throw cRuntimeError("Nic has no radioIn gate!");
 
-    outConns[other] = radioGate->getPathStartGate();
+    outConns.insert(other, radioGate->getPathStartGate());
 }
 
 void NicEntryDirect::disconnectFrom(NicEntry* other)
@@ -0,0 +1,108 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/connectionManager/RangeMask.h"
+
+#include "veins/base/utils/Simd.h"
+
+#if VEINS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+using namespace veins;
+
+namespace {
+
+void computeRangeMaskScalar(double px, double py, double pz, const double* x, const double* y, const double* z, size_t begin, size_t n, double maxDistSquared, RangeMask& mask)
+{
+    for (size_t i = begin; i < n; ++i) {
+        double dx = px - x[i];
+        double dy = py - y[i];
+        double dz = pz - z[i];
+        if (dx * dx + dy * dy + dz * dz <= maxDistSquared) {
+            setInRangeMask(mask, i);
+        }
+    }
+}
+
+#if VEINS_SIMD_X86
+// note: kernels must not contract multiplications and additions, so they yield the same results as the scalar code
+
+VEINS_SIMD_TARGET_SSE2 size_t computeRangeMaskSse2(double px, double py, double pz, const double* x, const double* y, const double* z, size_t n, double maxDistSquared, RangeMask& mask)
+{
+    const __m128d vpx = _mm_set1_pd(px);
+    const __m128d vpy = _mm_set1_pd(py);
+    const __m128d vpz = _mm_set1_pd(pz);
+    const __m128d vmax = _mm_set1_pd(maxDistSquared);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d dx = _mm_sub_pd(vpx, _mm_loadu_pd(x + i));
+        __m128d dy = _mm_sub_pd(vpy, _mm_loadu_pd(y + i));
+        __m128d dz = _mm_sub_pd(vpz, _mm_loadu_pd(z + i));
+        __m128d d = _mm_add_pd(_mm_add_pd(_mm_mul_pd(dx, dx), _mm_mul_pd(dy, dy)), _mm_mul_pd(dz, dz));
+        uint64_t bits = static_cast<uint64_t>(_mm_movemask_pd(_mm_cmple_pd(d, vmax)));
+        mask[i / 64] |= bits << (i % 64);
+    }
+    return i;
+}
+
+VEINS_SIMD_TARGET_AVX2 size_t computeRangeMaskAvx2(double px, double py, double pz, const double* x, const double* y, const double* z, size_t n, double maxDistSquared, RangeMask& mask)
+{
+    const __m256d vpx = _mm256_set1_pd(px);
+    const __m256d vpy = _mm256_set1_pd(py);
+    const __m256d vpz = _mm256_set1_pd(pz);
+    const __m256d vmax = _mm256_set1_pd(maxDistSquared);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d dx = _mm256_sub_pd(vpx, _mm256_loadu_pd(x + i));
+        __m256d dy = _mm256_sub_pd(vpy, _mm256_loadu_pd(y + i));
+        __m256d dz = _mm256_sub_pd(vpz, _mm256_loadu_pd(z + i));
+        __m256d d = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+        uint64_t bits = static_cast<uint64_t>(_mm256_movemask_pd(_mm256_cmp_pd(d, vmax, _CMP_LE_OQ)));
+        mask[i / 64] |= bits << (i % 64);
+    }
+    return i;
+}
+#endif
+
+} // namespace
+
+void veins::computeRangeMask(double px, double py, double pz, const double* x, const double* y, const double* z, size_t n, double maxDistSquared, RangeMask& mask)
+{
+    mask.assign((n + 63) / 64, 0);
+
+    size_t done = 0;
+#if VEINS_SIMD_X86
+    switch (simd::getInstructionSet()) {
+    case simd::InstructionSet::avx2:
+        done = computeRangeMaskAvx2(px, py, pz, x, y, z, n, maxDistSquared, mask);
+        break;
+    case simd::InstructionSet::sse2:
+        done = computeRangeMaskSse2(px, py, pz, x, y, z, n, maxDistSquared, mask);
+        break;
+    case simd::InstructionSet::scalar:
+        break;
+    }
+#endif
+    computeRangeMaskScalar(px, py, pz, x, y, z, done, n, maxDistSquared, mask);
+}
@@ -0,0 +1,87 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief Bitmask with one bit per slot of a grid cell.
+ *
+ * Bit i of the mask is stored in bit (i % 64) of word (i / 64).
+ *
+ * @ingroup connectionManager
+ */
+using RangeMask = std::vector<uint64_t>;
+
+/**
+ * @brief Computes which of n positions are within range of a given position.
+ *
+ * Sets bit i of mask if the squared (euclidean) distance between (px, py, pz) and
+ * (x[i], y[i], z[i]) is at most maxDistSquared; all other bits are cleared.
+ * The mask is resized to hold n bits.
+ *
+ * Dispatches to an AVX2 or SSE2 kernel if supported (see simd::getInstructionSet()).
+ * All kernels compute the squared distance exactly like Coord::sqrdist(), so results
+ * are identical regardless of the instruction set used.
+ *
+ * @ingroup connectionManager
+ */
+VEINS_API void computeRangeMask(double px, double py, double pz, const double* x, const double* y, const double* z, size_t n, double maxDistSquared, RangeMask& mask);
+
+/** @brief Returns whether bit i of mask is set. */
+inline bool isInRangeMask(const RangeMask& mask, size_t i)
+{
+    return (mask[i / 64] >> (i % 64)) & 1;
+}
+
+/** @brief Sets bit i of mask. */
+inline void setInRangeMask(RangeMask& mask, size_t i)
+{
+    mask[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+/** @brief Clears bit i of mask. */
+inline void clearInRangeMask(RangeMask& mask, size_t i)
+{
+    mask[i / 64] &= ~(uint64_t(1) << (i % 64));
+}
+
+/** @brief Returns the index of the lowest set bit of a (non-zero) mask word. */
+inline unsigned lowestSetBit(uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#else
+    unsigned bit = 0;
+    while (((word >> bit) & 1) == 0) ++bit;
+    return bit;
+#endif
+}
+
+} // namespace veins
@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -69,6 +70,22 @@ public:
      */
     virtual void filterSignal(Signal* signal) = 0;
 
+    /**
+     * Filters several Signals at once, e.g., all frames currently interfering at the receiver.
+     *
+     * Every Signal carries its own sender and receiver POA.
+     * Models can override this to compute setup shared by all Signals only once.
+     * The default implementation calls filterSignal() for each Signal in turn.
+     *
+     * @param signals       The signals to filter.
+     */
+    virtual void filterSignals(const std::vector<Signal*>& signals)
+    {
+        for (auto signal : signals) {
+            filterSignal(signal);
+        }
+    }
+
     /**
      * If the model never increases the power level of any signal given to filterSignal, it returns true here.
      * This allows optimized signal handling.
@@ -77,6 +94,27 @@ public:
     {
         return false;
     }
+
+    /**
+     * If the attenuation this model applies is a function of nothing but the (current) positions of sender and receiver and of the Spectrum of the signal, it returns true here.
+     * Such a model must only ever multiply the signal by this attenuation, which allows the attenuation of a link to be computed once and reused.
+     */
+    virtual bool dependsOnlyOnGeometry() const
+    {
+        return false;
+    }
+
+    /**
+     * Returns a distance beyond which this model attenuates every signal
+     * (of at least the given frequency) by at least the given factor, or
+     * infinity if there is no such distance.
+     *
+     * Inverts the model to bound the distance a transmission can reach.
+     */
+    virtual double getDistanceForAttenuation(double attenuation, double frequency)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
 };
 
 using AnalogueModelList = std::vector<std::unique_ptr<AnalogueModel>>;
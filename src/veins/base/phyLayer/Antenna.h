@@ -62,6 +62,14 @@ public:
      */
     virtual double getGain(Coord ownPos, Coord ownOrient, Coord otherPos);
 
+    /**
+     * Returns an upper bound of the gain of this antenna in any direction.
+     */
+    virtual double getMaxGain()
+    {
+        return 1.0;
+    };
+
     virtual double getLastAngle()
     {
         return -1.0;
@@ -24,6 +24,7 @@
 
 #include "veins/base/phyLayer/BasePhyLayer.h"
 
+#include <limits>
 #include <string>
 #include <sstream>
 #include <vector>
@@ -32,6 +33,7 @@
 #include "veins/base/utils/POA.h"
 #include "veins/modules/phy/SampledAntenna1D.h"
 #include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/base/phyLayer/CachingAnalogueModel.h"
 #include "veins/base/phyLayer/Decider.h"
 #include "veins/base/modules/BaseWorldUtility.h"
 #include "veins/base/connectionManager/BaseConnectionManager.h"
@@ -89,6 +91,21 @@ void BasePhyLayer::initialize(int stage)
         minPowerLevel = par("minPowerLevel").doubleValue();
         minPowerLevel = FWMath::dBm2mW(minPowerLevel);
 
+        adaptiveInterferenceDistance = readPar("adaptiveInterferenceDistance", false);
+        earlyRejection = readPar("earlyRejection", false);
+        interferenceMargin = FWMath::dBm2mW(readPar("interferenceMargin", 20.0));
+        preFilterReceivers = earlyRejection;
+
+        cacheAttenuation = readPar("cacheAttenuation", false);
+        attenuationCacheTolerance = readPar("attenuationCacheTolerance", 0.0);
+        attenuationCacheTimeout = readPar("attenuationCacheTimeout", 1.0);
+
+        signalPrecision = parseSignalPrecision(hasPar("signalPrecision") ? par("signalPrecision").stdstringValue() : "double");
+
+        if (readPar("incrementalInterference", false)) {
+            interferenceTracker = make_unique<InterferenceTracker>();
+        }
+
         recordStats = par("recordStats").boolValue();
 
         radio = initializeRadio();
@@ -184,6 +201,23 @@ void BasePhyLayer::finish()
     if (decider != nullptr) {
         decider->finish();
     }
+
+    if (earlyRejection) {
+        recordScalar("suppressedDeliveries", suppressedDeliveries);
+    }
+    if (cacheAttenuation) {
+        long hits = 0;
+        long misses = 0;
+        long evictions = 0;
+        for (auto attenuationCache : attenuationCaches) {
+            hits += attenuationCache->getNumHits();
+            misses += attenuationCache->getNumMisses();
+            evictions += attenuationCache->getNumEvictions();
+        }
+        recordScalar("attenuationCacheHits", hits);
+        recordScalar("attenuationCacheMisses", misses);
+        recordScalar("attenuationCacheEvictions", evictions);
+    }
 }
 
 // -----Decider initialization----------------------
@@ -356,6 +390,13 @@ void BasePhyLayer::initializeAnalogueModels(cXMLElement* xmlConfig)
             throw cRuntimeError("Could not find an analogue model with the name \"%s\".", name);
         }
 
+        // reuse the attenuation per link of models which depend only on geometry, be they applied now or with thresholding
+        if (cacheAttenuation && newAnalogueModel->dependsOnlyOnGeometry()) {
+            auto cachingAnalogueModel = make_unique<CachingAnalogueModel>(this, std::move(newAnalogueModel), attenuationCacheTolerance, attenuationCacheTimeout, signalPrecision);
+            attenuationCaches.push_back(cachingAnalogueModel.get());
+            newAnalogueModel = std::move(cachingAnalogueModel);
+        }
+
         // attach the new AnalogueModel to the AnalogueModelList
         if (thresholdingFlag && std::string(thresholdingFlag) == "true") {
             if (!newAnalogueModel->neverIncreasesPower()) {
@@ -441,6 +482,15 @@ void BasePhyLayer::handleAirFrameStartReceive(AirFrame* frame)
     ASSERT(frame->getSignal().getReceptionStart() == simTime());
 
     filterSignal(frame);
+    if (signalPrecision != SignalPrecision::Double) {
+        // round what the decider would see, i.e., the power after all analogue models (including those for thresholding)
+        frame->getSignal().applyAllAnalogueModels();
+        quantize(frame->getSignal(), signalPrecision);
+    }
+
+    if (interferenceTracker) {
+        interferenceTracker->addAirFrame(frame, simTime());
+    }
 
     if (decider && isKnownProtocolId(frame->getProtocolId())) {
         frame->setState(static_cast<int>(AirFrameState::receiving));
@@ -478,6 +528,11 @@ void BasePhyLayer::handleAirFrameReceiving(AirFrame* frame)
 
     // smaller zero means don't give it to me again
     if (nextHandleTime < 0) {
+        if (decider->isInterferenceOnly(frame)) {
+            handleAirFrameInterferenceOnly(frame);
+            return;
+        }
+
         nextHandleTime = signalEndTime;
         frame->setState(static_cast<int>(AirFrameState::end_receive));
 
@@ -496,6 +551,10 @@ void BasePhyLayer::handleAirFrameEndReceive(AirFrame* frame)
 {
     EV_TRACE << "End of Airframe with ID " << frame->getId() << "." << endl;
 
+    if (interferenceTracker) {
+        interferenceTracker->removeAirFrame(frame, simTime());
+    }
+
     simtime_t earliestInfoPoint = channelInfo.removeAirFrame(frame);
 
     /* clean information in the radio until earliest time-point
@@ -508,6 +567,19 @@ void BasePhyLayer::handleAirFrameEndReceive(AirFrame* frame)
     }
 }
 
+void BasePhyLayer::handleAirFrameInterferenceOnly(AirFrame* frame)
+{
+    EV_TRACE << "Releasing AirFrame with ID " << frame->getId() << ", which only matters as interference." << endl;
+
+    frame->setState(static_cast<int>(AirFrameState::interference_only));
+
+    if (interferenceTracker) {
+        interferenceTracker->removeAirFrame(frame, simTime());
+    }
+
+    channelInfo.releaseAirFrame(frame);
+}
+
 void BasePhyLayer::handleUpperMessage(cMessage* msg)
 {
 
@@ -629,10 +701,80 @@ void BasePhyLayer::sendMacPktUp(cMessage* pkt)
 
 void BasePhyLayer::sendMessageDown(AirFrame* msg)
 {
+    if (adaptiveInterferenceDistance) {
+        sendToChannel(msg, getMaxTransmissionDistance(msg->getSignal()));
+        return;
+    }
 
     sendToChannel(msg);
 }
 
+double BasePhyLayer::getMaxTransmissionDistance(const Signal& signal)
+{
+    // the frame must reach the nic that needs the least attenuation to drop below its threshold
+    double maxGainPerThreshold = 0;
+    for (auto&& entry : cc->getGateList(getParentModule()->getId())) {
+        BasePhyLayer* receiverPhy = dynamic_cast<BasePhyLayer*>(entry.chAccess);
+        if (receiverPhy == nullptr) return std::numeric_limits<double>::infinity();
+        maxGainPerThreshold = std::max(maxGainPerThreshold, receiverPhy->antenna->getMaxGain() / receiverPhy->getInterferenceThreshold());
+    }
+    if (maxGainPerThreshold == 0) return 0;
+
+    double attenuation = 1 / (signal.getMax() * antenna->getMaxGain() * maxGainPerThreshold);
+    // the lowest frequency travels farthest
+    double distance = getDistanceForAttenuation(attenuation, signal.getSpectrum().freqAt(0));
+
+    EV_TRACE << "transmission reaches at most " << distance << "m" << endl;
+    return distance;
+}
+
+double BasePhyLayer::getMaxReceptionDistance(double power, double frequency, double threshold) const
+{
+    return getDistanceForAttenuation(threshold / power, frequency);
+}
+
+double BasePhyLayer::getDistanceForAttenuation(double attenuation, double frequency) const
+{
+    // every analogue model only attenuates further, so each of them bounds the distance on its own
+    double distance = std::numeric_limits<double>::infinity();
+    for (auto analogueModelList : {&analogueModels, &analogueModelsThresholding}) {
+        for (auto& analogueModel : *analogueModelList) {
+            if (!analogueModel->neverIncreasesPower()) {
+                return std::numeric_limits<double>::infinity();
+            }
+            distance = std::min(distance, analogueModel->getDistanceForAttenuation(attenuation, frequency));
+        }
+    }
+    return distance;
+}
+
+bool BasePhyLayer::isNegligibleAt(cPacket* msg, ChannelAccess* receiver, double distance)
+{
+    AirFrame* frame = dynamic_cast<AirFrame*>(msg);
+    BasePhyLayer* receiverPhy = dynamic_cast<BasePhyLayer*>(receiver);
+    if (frame == nullptr || receiverPhy == nullptr) return false;
+
+    const Signal& signal = frame->getSignal();
+    double power = signal.getMax() * antenna->getMaxGain() * receiverPhy->antenna->getMaxGain();
+    // the lowest frequency travels farthest
+    return distance > receiverPhy->getMaxReceptionDistance(power, signal.getSpectrum().freqAt(0), receiverPhy->getInterferenceThreshold());
+}
+
+double BasePhyLayer::getLowestRelevantPower() const
+{
+    double power = minPowerLevel;
+    if (noiseFloorValue > 0) {
+        power = std::min(power, noiseFloorValue);
+    }
+    return power;
+}
+
+double BasePhyLayer::getInterferenceThreshold() const
+{
+    // frames below the lowest relevant power can still add up to it, so leave room for many of them
+    return getLowestRelevantPower() / interferenceMargin;
+}
+
 void BasePhyLayer::sendSelfMessage(cMessage* msg, simtime_t_cref time)
 {
     // TODO: maybe delete this method because it doesn't makes much sense,
@@ -773,6 +915,11 @@ void BasePhyLayer::getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFra
     channelInfo.getAirFrames(from, to, out);
 }
 
+InterferenceTracker* BasePhyLayer::getInterferenceTracker()
+{
+    return interferenceTracker.get();
+}
+
 double BasePhyLayer::getNoiseFloorValue()
 {
     return noiseFloorValue;
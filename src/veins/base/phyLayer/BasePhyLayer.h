@@ -36,6 +36,9 @@
 #include "veins/base/phyLayer/MacToPhyInterface.h"
 #include "veins/base/phyLayer/Antenna.h"
 #include "veins/base/phyLayer/ChannelInfo.h"
+#include "veins/base/phyLayer/InterferenceTracker.h"
+#include "veins/base/toolbox/Signal.h"
+#include "veins/base/toolbox/SignalPrecision.h"
 
 namespace veins {
 
@@ -46,6 +49,7 @@ class BaseWorldUtility;
 class AirFrame;
 class ChannelAccess;
 class Radio;
+class CachingAnalogueModel;
 
 /**
  * The BasePhyLayer represents the physical layer of a nic.
@@ -96,7 +100,8 @@ protected:
     enum class AirFrameState {
         start_receive = 1, ///< Start of actual receiving process of the AirFrame.
         receiving, ///< AirFrame is being received.
-        end_receive ///< Receiving process over.
+        end_receive, ///< Receiving process over.
+        interference_only ///< AirFrame only matters as interference until its end and is not handled again.
     };
 
     enum ProtocolIds {
@@ -116,8 +121,13 @@ protected:
     int protocolId = PROTOCOL_ID_GENERIC; ///< The ID of the protocol this phy can transceive.
     double noiseFloorValue = 0; ///< Catch-all for all factors negatively impacting SINR (e.g., thermal noise, noise figure, ...)
     double minPowerLevel; ///< The minimum receive power needed to even attempt decoding a frame.
+    bool adaptiveInterferenceDistance; ///< Limits every transmission to the distance at which it drops below every connected nic's getInterferenceThreshold().
+    bool earlyRejection; ///< Skips delivery to every nic at which a transmission provably arrives below that nic's getInterferenceThreshold().
+    double interferenceMargin; ///< The factor by which getInterferenceThreshold() stays below getLowestRelevantPower(), to account for summed interferers.
+    SignalPrecision signalPrecision; ///< The precision cached attenuations are stored in and every received Signal is rounded to after applying all analogue models.
     bool recordStats; ///< Stores if tracking of statistics (esp. cOutvectors) is enabled.
     ChannelInfo channelInfo; ///< Channel info keeps track of received AirFrames and provides information about currently active AirFrames at the channel.
+    std::unique_ptr<InterferenceTracker> interferenceTracker; ///< Keeps the summed power of received AirFrames up to date, if incrementalInterference is set.
     std::unique_ptr<Radio> radio; ///< The state machine storing the current radio state (TX, RX, SLEEP).
 
     /**
@@ -142,6 +152,11 @@ protected:
      */
     AnalogueModelList analogueModelsThresholding;
 
+    bool cacheAttenuation; ///< Wraps every model which depends only on geometry (in analogueModels as well as analogueModelsThresholding) in a CachingAnalogueModel.
+    double attenuationCacheTolerance; ///< The distance [m] either antenna may move before a cached attenuation is recomputed.
+    simtime_t attenuationCacheTimeout; ///< The time after its last use a cached attenuation is discarded.
+    std::vector<CachingAnalogueModel*> attenuationCaches; ///< The CachingAnalogueModels among analogueModels and analogueModelsThresholding, for statistics.
+
     int upperLayerIn; ///< The id of the in-data gate from the Mac layer.
     int upperLayerOut; ///< The id of the out-data gate to the Mac layer.
     int upperControlOut; ///< The id of the out-control gate to the Mac layer.
@@ -153,11 +168,6 @@ protected:
     BaseWorldUtility* world = nullptr; ///< Pointer to the World Utility, to obtain some global information
 
 private:
-    /**
-     * Read the parameters of a XML element and stores them in the passed ParameterMap reference.
-     */
-    void getParametersFromXML(cXMLElement* xmlData, ParameterMap& outputMap);
-
     /**
      * Initialize the AnalogueModels with the data from the passed XML-config data.
      */
@@ -174,6 +184,11 @@ private:
     void initializeAntenna(cXMLElement* xmlConfig);
 
 protected:
+    /**
+     * Read the parameters of a XML element and stores them in the passed ParameterMap reference.
+     */
+    void getParametersFromXML(cXMLElement* xmlData, ParameterMap& outputMap);
+
     /**
      * Read and return the parameter with the passed name.
      *
@@ -281,6 +296,13 @@ protected:
      */
     virtual void handleAirFrameEndReceive(AirFrame* msg);
 
+    /**
+     * Release an AirFrame which the Decider considers to only matter as interference.
+     *
+     * The AirFrame keeps being part of the channel until its end, but its end is not handled.
+     */
+    virtual void handleAirFrameInterferenceOnly(AirFrame* msg);
+
     /*@}*/
 
     /**
@@ -303,6 +325,52 @@ protected:
      */
     void sendMessageDown(AirFrame* pkt);
 
+    /**
+     * Returns the distance beyond which the passed Signal arrives at every
+     * connected nic with less than its getInterferenceThreshold(), bounded by
+     * the maximum antenna gains of this nic and the connected nics, or
+     * infinity if it cannot be bounded.
+     *
+     * Requires all analogue models to never increase power.
+     */
+    double getMaxTransmissionDistance(const Signal& signal);
+
+    /**
+     * Returns the distance beyond which a transmission with the passed
+     * power (including all antenna gains) arrives at this nic with less than
+     * the passed threshold, or infinity if it cannot be bounded.
+     */
+    double getMaxReceptionDistance(double power, double frequency, double threshold) const;
+
+    /**
+     * Returns the smallest distance at which this nic's analogue models
+     * attenuate a signal by at least the passed factor, or infinity if
+     * one of them might increase power.
+     */
+    double getDistanceForAttenuation(double attenuation, double frequency) const;
+
+    /**
+     * Bounds the receive power of the passed AirFrame at the passed receiver
+     * by the maximum antenna gains of both nics and the receiver's analogue
+     * models, and compares it to the receiver's getInterferenceThreshold().
+     */
+    bool isNegligibleAt(cPacket* msg, ChannelAccess* receiver, double distance) override;
+
+    /**
+     * Returns the lowest power [mW] any threshold of this nic compares received power against:
+     * minPowerLevel and (if used) the noise floor.
+     *
+     * Subclasses whose decider compares the summed power of all frames against further thresholds (e.g., for CCA) add these.
+     */
+    virtual double getLowestRelevantPower() const;
+
+    /**
+     * Returns the receive power [mW] below which adaptiveInterferenceDistance and earlyRejection drop a frame:
+     * getLowestRelevantPower() lowered by interferenceMargin, so that even many dropped frames
+     * could not have added up to a change in CCA or reception at this nic.
+     */
+    double getInterferenceThreshold() const;
+
     /**
      * Schedule self message to passed point in time.
      */
@@ -429,6 +497,11 @@ public:
      */
     void getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out) override;
 
+    /**
+     * Return the InterferenceTracker, or nullptr if incrementalInterference is not set.
+     */
+    InterferenceTracker* getInterferenceTracker() override;
+
     /**
      * Return noise floor level (in mW).
      */
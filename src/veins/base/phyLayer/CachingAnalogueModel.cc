@@ -0,0 +1,140 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/phyLayer/CachingAnalogueModel.h"
+
+using namespace veins;
+
+CachingAnalogueModel::CachingAnalogueModel(cComponent* owner, std::unique_ptr<AnalogueModel> model, double tolerance, simtime_t timeout, SignalPrecision precision)
+    : AnalogueModel(owner)
+    , model(std::move(model))
+    , tolerance(tolerance)
+    , timeout(timeout)
+    , precision(precision)
+    , lastSweep(simTime())
+{
+    ASSERT(this->model && this->model->dependsOnlyOnGeometry());
+}
+
+void CachingAnalogueModel::filterSignal(Signal* signal)
+{
+    discardExpired();
+
+    if (const CompactSignalValues* attenuation = lookup(*signal)) {
+        attenuation->multiplyInto(*signal);
+        return;
+    }
+
+    Signal attenuation = createUnitSignal(*signal);
+    model->filterSignal(&attenuation);
+    store(*signal, attenuation).multiplyInto(*signal);
+}
+
+void CachingAnalogueModel::filterSignals(const std::vector<Signal*>& signals)
+{
+    discardExpired();
+
+    // answer what we can from the cache and let the wrapped model compute the remaining links in one batch
+    std::vector<Signal*> missed;
+    for (auto signal : signals) {
+        if (const CompactSignalValues* attenuation = lookup(*signal)) {
+            attenuation->multiplyInto(*signal);
+        }
+        else {
+            missed.push_back(signal);
+        }
+    }
+    if (missed.empty()) return;
+
+    std::vector<Signal> attenuations;
+    attenuations.reserve(missed.size());
+    for (auto signal : missed) {
+        attenuations.push_back(createUnitSignal(*signal));
+    }
+    std::vector<Signal*> pending;
+    pending.reserve(attenuations.size());
+    for (auto& attenuation : attenuations) {
+        pending.push_back(&attenuation);
+    }
+    model->filterSignals(pending);
+
+    for (size_t i = 0; i < missed.size(); ++i) {
+        store(*missed[i], attenuations[i]).multiplyInto(*missed[i]);
+    }
+}
+
+const CompactSignalValues* CachingAnalogueModel::lookup(const Signal& signal)
+{
+    const POA senderPoa = signal.getSenderPoa();
+    auto it = cache.find(senderPoa.pos.getId());
+    if (it == cache.end()) return nullptr;
+
+    Entry& entry = it->second;
+    bool hit = entry.spectrum == signal.getSpectrum();
+    hit = hit && entry.senderPos.distance(senderPoa.pos.getPositionAt()) <= tolerance;
+    hit = hit && entry.receiverPos.distance(signal.getReceiverPoa().pos.getPositionAt()) <= tolerance;
+    if (!hit) return nullptr;
+
+    entry.lastUse = simTime();
+    numHits++;
+    return &entry.attenuation;
+}
+
+const CompactSignalValues& CachingAnalogueModel::store(const Signal& signal, const Signal& attenuation)
+{
+    const POA senderPoa = signal.getSenderPoa();
+    Entry& entry = cache[senderPoa.pos.getId()];
+    entry.senderPos = senderPoa.pos.getPositionAt();
+    entry.receiverPos = signal.getReceiverPoa().pos.getPositionAt();
+    entry.spectrum = signal.getSpectrum();
+    entry.attenuation = CompactSignalValues(attenuation, precision);
+    entry.lastUse = simTime();
+    numMisses++;
+    return entry.attenuation;
+}
+
+Signal CachingAnalogueModel::createUnitSignal(const Signal& signal)
+{
+    Signal unit(signal.getSpectrum());
+    unit = 1;
+    unit.setSenderPoa(signal.getSenderPoa());
+    unit.setReceiverPoa(signal.getReceiverPoa());
+    return unit;
+}
+
+void CachingAnalogueModel::discardExpired()
+{
+    const simtime_t now = simTime();
+    if (now - lastSweep < timeout) return;
+    lastSweep = now;
+
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (now - it->second.lastUse >= timeout) {
+            it = cache.erase(it);
+            numEvictions++;
+        }
+        else {
+            ++it;
+        }
+    }
+}
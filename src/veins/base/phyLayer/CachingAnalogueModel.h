@@ -0,0 +1,150 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/base/toolbox/Signal.h"
+#include "veins/base/toolbox/SignalPrecision.h"
+#include "veins/base/utils/Coord.h"
+
+namespace veins {
+
+/**
+ * @brief Wraps an AnalogueModel which depends only on geometry and reuses the attenuation it computed for a link.
+ *
+ * The attenuation of a link is computed once by filtering a unit Signal and multiplied onto later Signals of the same sender,
+ * until its Spectrum changes, either antenna moved by more than the tolerance, or the entry expires.
+ * As a model instance belongs to a single receiver, links are identified by the id of the sender's antenna.
+ *
+ * Entries not used for the timeout are discarded, so the cache only holds links that are still active.
+ * Expired entries are swept at most once per timeout, which keeps the cost per lookup constant.
+ * Attenuations are stored as CompactSignalValues in the given SignalPrecision. Frames of a link are attenuated
+ * by the stored (i.e., rounded) values whether they hit or miss the cache.
+ *
+ * Works the same whether the model is applied immediately or lazily (i.e., with thresholding),
+ * as every Signal carries the POAs of its sender and receiver.
+ *
+ * @ingroup analogueModels
+ */
+class VEINS_API CachingAnalogueModel : public AnalogueModel {
+public:
+    /**
+     * @param owner         The component to log for.
+     * @param model         The wrapped model, which must return true for dependsOnlyOnGeometry().
+     * @param tolerance     The distance [m] either antenna may move before a cached attenuation is recomputed.
+     * @param timeout       The time after its last use a cached attenuation is discarded.
+     * @param precision     The representation cached attenuations are stored in.
+     */
+    CachingAnalogueModel(cComponent* owner, std::unique_ptr<AnalogueModel> model, double tolerance, simtime_t timeout, SignalPrecision precision = SignalPrecision::Double);
+
+    void filterSignal(Signal* signal) override;
+    void filterSignals(const std::vector<Signal*>& signals) override;
+
+    bool neverIncreasesPower() override
+    {
+        return model->neverIncreasesPower();
+    }
+
+    bool dependsOnlyOnGeometry() const override
+    {
+        return true;
+    }
+
+    double getDistanceForAttenuation(double attenuation, double frequency) override
+    {
+        return model->getDistanceForAttenuation(attenuation, frequency);
+    }
+
+    long getNumHits() const
+    {
+        return numHits;
+    }
+    long getNumMisses() const
+    {
+        return numMisses;
+    }
+    long getNumEvictions() const
+    {
+        return numEvictions;
+    }
+
+    /**
+     * Returns the number of links an attenuation is currently cached for.
+     */
+    size_t size() const
+    {
+        return cache.size();
+    }
+
+protected:
+    /**
+     * The attenuation of a link, along with the positions of both antennas it was computed for.
+     */
+    struct Entry {
+        Coord senderPos;
+        Coord receiverPos;
+        Spectrum spectrum;
+        CompactSignalValues attenuation;
+        simtime_t lastUse;
+    };
+
+    /**
+     * Returns the cached attenuation for the link of the passed Signal, or nullptr if it has to be recomputed.
+     */
+    const CompactSignalValues* lookup(const Signal& signal);
+
+    /**
+     * Stores the attenuation for the link of the passed Signal and returns the stored values.
+     */
+    const CompactSignalValues& store(const Signal& signal, const Signal& attenuation);
+
+    /**
+     * Returns a Signal of power 1 on the Spectrum and between the POAs of the passed Signal, for the wrapped model to filter.
+     */
+    static Signal createUnitSignal(const Signal& signal);
+
+    /**
+     * Discards all entries not used for the timeout, if the last sweep is at least that long ago.
+     */
+    void discardExpired();
+
+protected:
+    std::unique_ptr<AnalogueModel> model;
+    double tolerance;
+    simtime_t timeout;
+    SignalPrecision precision;
+    std::unordered_map<int, Entry> cache; ///< Cached attenuations by id of the sender's antenna.
+    simtime_t lastSweep;
+    long numHits = 0;
+    long numMisses = 0;
+    long numEvictions = 0;
+};
+
+} // namespace veins
@@ -24,197 +24,207 @@
 
 #include "veins/base/phyLayer/ChannelInfo.h"
 
-#include <iostream>
+#include <algorithm>
 
 using namespace veins;
 
 using veins::AirFrame;
 
+const size_t ChannelInfo::minSweepThreshold;
+
+ChannelInfo::~ChannelInfo()
+{
+    // AirFrames which are still needed are returned by getAirFrames() and deleted by our owner
+    simtime_t horizon = getDiscardHorizon();
+    for (size_t i = head; i < entries.size(); ++i) {
+        if (!isNeeded(entries[i], horizon)) {
+            delete entries[i].frame;
+        }
+    }
+}
+
 void ChannelInfo::addAirFrame(AirFrame* frame, simtime_t_cref startTime)
 {
-    ASSERT(airFrameStarts.count(frame) == 0);
+    ASSERT(isChannelEmpty() || entries.back().start <= startTime);
+
+    // released AirFrames which ended until now are removed first
+    if (advanceTo(startTime)) {
+        discardUnneeded();
+    }
 
     // check if we were previously empty
     if (isChannelEmpty()) {
         // earliest time point is current sim time
         earliestInfoPoint = startTime;
+        maxDuration = SIMTIME_ZERO;
     }
 
-    // calculate endTime of AirFrame
-    simtime_t_cref endTime = startTime + frame->getDuration();
+    // add AirFrame to active AirFrames (if there were none, firstActive already points here)
+    activePositions[frame] = numDropped + entries.size();
+    entries.push_back({startTime, startTime + frame->getDuration(), frame, true});
+    numActive++;
 
-    // add AirFrame to active AirFrames
-    activeAirFrames[endTime].push_back(AirFrameTimePair(startTime, frame));
-
-    // add to start time map
-    airFrameStarts[frame] = startTime;
+    if (frame->getDuration() > maxDuration) {
+        maxDuration = frame->getDuration();
+    }
 
     ASSERT(!isChannelEmpty());
 }
 
 simtime_t ChannelInfo::findEarliestInfoPoint()
 {
-    // TODO: check for a more efficient way to find out that earliest time-point
-
-    // make a variable for the earliest-start-time of all remaining AirFrames
-    simtime_t earliestStart = SIMTIME_ZERO;
-    AirFrameStartMap::const_iterator it = airFrameStarts.begin();
-
-    // if there is an entry for an AirFrame
-    if (it != airFrameStarts.end()) {
-        // store the start-time of the first entry as earliestStart so far
-        earliestStart = (*it).second;
-
-        // go through all other start-time-points
-        for (; it != airFrameStarts.end(); ++it) {
-            // and check if an earlier start-time was found,
-            // if so, replace earliestStart with it
-            if ((*it).second < earliestStart) earliestStart = (*it).second;
-        }
-    }
+    // discardUnneeded() deleted all unneeded AirFrames at the front, so the oldest one is at head
+    ASSERT(!isChannelEmpty());
 
-    return earliestStart;
+    return entries[head].start;
 }
 
-simtime_t ChannelInfo::removeAirFrame(AirFrame* frame)
+size_t ChannelInfo::findActive(AirFrame* frame) const
 {
-    ASSERT(airFrameStarts.count(frame) > 0);
-
-    // get start of AirFrame
-    simtime_t_cref startTime = airFrameStarts[frame];
+    auto position = activePositions.find(frame);
+    ASSERT(position != activePositions.end());
 
-    // calculate end time
-    simtime_t_cref endTime = startTime + frame->getDuration();
-
-    // remove this AirFrame from active AirFrames
-    deleteAirFrame(activeAirFrames, frame, startTime, endTime);
-
-    // add to inactive AirFrames
-    addToInactives(frame, startTime, endTime);
-
-    // Now check, whether the earliest time-point we need to store information
-    // for might have moved on in time, since an AirFrame has been deleted.
-    if (isChannelEmpty()) {
-        earliestInfoPoint = -1;
-    }
-    else {
-        earliestInfoPoint = findEarliestInfoPoint();
-    }
-
-    return earliestInfoPoint;
+    return position->second - numDropped;
 }
 
-void ChannelInfo::assertNoIntersections()
+void ChannelInfo::deactivate(size_t index)
 {
-    for (AirFrameMatrix::iterator it1 = inactiveAirFrames.begin(); it1 != inactiveAirFrames.end(); ++it1) {
-        simtime_t_cref e0 = it1->first;
-        for (AirFrameTimeList::iterator it2 = it1->second.begin(); it2 != it1->second.end(); ++it2) {
-            simtime_t_cref s0 = it2->first;
-
-            bool intersects = (recordStartTime > -1 && recordStartTime <= e0);
-
-            for (AirFrameMatrix::iterator it3 = activeAirFrames.begin(); it3 != activeAirFrames.end() && !intersects; ++it3) {
-                simtime_t_cref e1 = it3->first;
-                for (AirFrameTimeList::iterator it4 = it3->second.begin(); it4 != it3->second.end() && !intersects; ++it4) {
-                    simtime_t_cref s1 = it4->first;
-
-                    if (e0 >= s1 && s0 <= e1) intersects = true;
-                }
-            }
-            ASSERT(intersects);
-        }
+    // move it to the inactive AirFrames
+    entries[index].active = false;
+    activePositions.erase(entries[index].frame);
+    numActive--;
+
+    while (firstActive < entries.size() && !entries[firstActive].active) {
+        ++firstActive;
     }
 }
 
-void ChannelInfo::deleteAirFrame(AirFrameMatrix& airFrames, AirFrame* frame, simtime_t_cref startTime, simtime_t_cref endTime)
+bool ChannelInfo::advanceTo(simtime_t_cref time)
 {
-    AirFrameMatrix::iterator listIt = airFrames.find(endTime);
-    AirFrameTimeList* list = &listIt->second;
-
-    for (AirFrameTimeList::iterator it = list->begin(); it != list->end(); it++) {
-        if (it->second == frame) {
-            it = list->erase(it);
-            if (list->empty()) {
-                airFrames.erase(listIt);
-            }
-            return;
-        }
+    if (time > currentTime) {
+        currentTime = time;
     }
 
-    ASSERT(false);
+    bool removed = false;
+    while (!releasedEnds.empty() && releasedEnds.top().first <= currentTime) {
+        deactivate(findActive(releasedEnds.top().second));
+        releasedEnds.pop();
+        removed = true;
+    }
+    return removed;
 }
 
-bool ChannelInfo::canDiscardInterval(simtime_t_cref startTime, simtime_t_cref endTime)
+simtime_t ChannelInfo::removeAirFrame(AirFrame* frame)
 {
-    ASSERT(recordStartTime >= 0 || recordStartTime == -1);
+    size_t i = findActive(frame);
+    simtime_t endTime = entries[i].end;
 
-    // only if it ends before the point in time we started recording or if
-    // we aren't recording at all and it does not intersect with any active one
-    // anymore this AirFrame can be deleted
-    return (recordStartTime > endTime || recordStartTime == -1) && !isIntersecting(activeAirFrames, startTime, endTime);
-}
+    deactivate(i);
+    advanceTo(endTime);
 
-void ChannelInfo::checkAndCleanInterval(simtime_t_cref startTime, simtime_t_cref endTime)
-{
+    discardUnneeded();
 
-    // get through inactive AirFrame which intersected with the passed interval
-    IntersectionIterator inactiveIntersectIt(&inactiveAirFrames, startTime, endTime);
+    return earliestInfoPoint;
+}
 
-    AirFrame* inactiveIntersect = inactiveIntersectIt.next();
-    while (inactiveIntersect != nullptr) {
-        simtime_t_cref currentStart = airFrameStarts[inactiveIntersect];
-        simtime_t_cref currentEnd = currentStart + inactiveIntersect->getDuration();
+void ChannelInfo::releaseAirFrame(AirFrame* frame)
+{
+    releasedEnds.push({entries[findActive(frame)].end, frame});
+}
 
-        if (canDiscardInterval(currentStart, currentEnd)) {
-            inactiveIntersectIt.eraseAirFrame();
+void ChannelInfo::assertNoIntersections()
+{
+    simtime_t horizon = getDiscardHorizon();
+    for (size_t i = head; i < entries.size(); ++i) {
+        const Entry& inactive = entries[i];
+        if (inactive.active) continue;
+        if (!isNeeded(inactive, horizon)) continue;
 
-            airFrameStarts.erase(inactiveIntersect);
+        bool intersects = (recordStartTime > -1 && recordStartTime <= inactive.end);
 
-            delete inactiveIntersect;
-            inactiveIntersect = nullptr;
+        for (size_t j = firstActive; j < entries.size() && !intersects; ++j) {
+            const Entry& active = entries[j];
+            if (active.active && inactive.end >= active.start && inactive.start <= active.end) intersects = true;
         }
-        inactiveIntersect = inactiveIntersectIt.next();
+        ASSERT(intersects);
     }
 }
 
-void ChannelInfo::addToInactives(AirFrame* frame, simtime_t_cref startTime, simtime_t_cref endTime)
+void ChannelInfo::discardUnneeded()
 {
-    // At first, check if some inactive AirFrames can be removed because the
-    // AirFrame to in-activate was the last one they intersected with.
-    checkAndCleanInterval(startTime, endTime);
+    simtime_t horizon = getDiscardHorizon();
 
-    if (!canDiscardInterval(startTime, endTime)) {
-        inactiveAirFrames[endTime].push_back(AirFrameTimePair(startTime, frame));
+    // every entry in front of the first active one is inactive, so head never passes it
+    while (head < firstActive && !isNeeded(entries[head], horizon)) {
+        delete entries[head].frame;
+        ++head;
     }
-    else {
-        airFrameStarts.erase(frame);
 
-        delete frame;
+    if (numActive == 0 || firstActive - head >= sweepThreshold) {
+        sweep();
     }
-}
 
-bool ChannelInfo::isIntersecting(const AirFrameMatrix& airFrames, simtime_t_cref from, simtime_t_cref to) const
-{
-    ConstIntersectionIterator it(&airFrames, from, to);
-    return (it.next() != nullptr);
+    // drop deleted entries once they make up most of the buffer
+    if (head == entries.size()) {
+        numDropped += entries.size();
+        entries.clear();
+        head = 0;
+        firstActive = 0;
+    }
+    else if (head >= minSweepThreshold && head > entries.size() / 2) {
+        numDropped += head;
+        entries.erase(entries.begin(), entries.begin() + head);
+        firstActive -= head;
+        head = 0;
+    }
+    // Now check, whether the earliest time-point we need to store information
+    // for might have moved on in time, since AirFrames have been deleted.
+    if (isChannelEmpty()) {
+        earliestInfoPoint = -1;
+    }
+    else {
+        earliestInfoPoint = findEarliestInfoPoint();
+    }
 }
 
-void ChannelInfo::getIntersections(const AirFrameMatrix& airFrames, simtime_t_cref from, simtime_t_cref to, AirFrameVector& outVector) const
+void ChannelInfo::sweep()
 {
-    ConstIntersectionIterator it(&airFrames, from, to);
-
-    AirFrame* intersect = it.next();
-    while (intersect != nullptr) {
-        outVector.push_back(intersect);
-        intersect = it.next();
+    simtime_t horizon = getDiscardHorizon();
+
+    // only inactive entries in front of the first active one can end before the horizon,
+    // so compact these towards the first active entry
+    size_t kept = firstActive;
+    for (size_t i = firstActive; i > head; --i) {
+        Entry& entry = entries[i - 1];
+        if (isNeeded(entry, horizon)) {
+            entries[--kept] = entry;
+        }
+        else {
+            delete entry.frame;
+        }
     }
+    head = kept;
+
+    sweepThreshold = std::max(minSweepThreshold, 2 * (firstActive - head));
 }
 
 void ChannelInfo::getAirFrames(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out) const
 {
-    // check for intersecting inactive AirFrames
-    getIntersections(inactiveAirFrames, from, to, out);
-
-    // check for intersecting active AirFrames
-    getIntersections(activeAirFrames, from, to, out);
+    auto startsBefore = [](const Entry& entry, simtime_t_cref time) {
+        return entry.start < time;
+    };
+    auto startsAfter = [](simtime_t_cref time, const Entry& entry) {
+        return time < entry.start;
+    };
+
+    // no AirFrame starting earlier than the longest AirFrame before from can end after from
+    auto first = std::lower_bound(entries.begin() + head, entries.end(), from - maxDuration, startsBefore);
+    auto last = std::upper_bound(first, entries.end(), to, startsAfter);
+
+    simtime_t horizon = getDiscardHorizon();
+    for (auto it = first; it != last; ++it) {
+        if (it->end >= from && isNeeded(*it, horizon)) {
+            out.push_back(it->frame);
+        }
+    }
 }
@@ -25,6 +25,9 @@
 #pragma once
 
 #include <list>
+#include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include "veins/veins.h"
 
@@ -61,202 +64,91 @@ namespace veins {
  *          This also affects "getAirFrames" in the way that you may only ask for
  *          intervals which lie before the "current time" of ChannelInfo.
  *
+ * Because AirFrames are added chronologically, ChannelInfo stores them in a
+ * single contiguous buffer ordered by start time, which makes adding an
+ * AirFrame an append and lets interval queries start with a binary search.
+ *
+ * An inactive AirFrame is no longer needed as soon as it ends before the
+ * earliest start of all active AirFrames (and before the record start time).
+ * This point in time only moves forward, so AirFrames which are no longer
+ * needed are simply skipped by queries and deleted in batches.
+ *
+ * AirFrames which only matter as interference can be released right after
+ * they have been added (see releaseAirFrame()), instead of being removed at
+ * their end. ChannelInfo then removes them itself as soon as it is told about
+ * a point in time at or after their end.
+ *
  * @ingroup phyLayer
  */
 class VEINS_API ChannelInfo {
 
-protected:
-    /** @brief Type for a pair of an AirFrame and a simulation time.*/
-    typedef std::pair<simtime_t, AirFrame*> AirFrameTimePair;
-    /** @brief Type for a list of AirFrames and a simulation time.*/
-    using AirFrameTimeList = std::list<AirFrameTimePair>;
-    /**
-     * The AirFrames are stored in a Matrix with start- and end time as
-     * dimensions.
-     */
-    typedef std::map<simtime_t, AirFrameTimeList> AirFrameMatrix;
-
+public:
     /**
-     * @brief Iterator for every intersection of a specific interval in a
-     * AirFrameMatrix.
-     *
-     * A time interval A_start to A_end intersects with another interval B_start
-     * to B_end iff the following two conditions are fulfilled:
-     *
-     *         1. A_end >= B_start.
-     *         2. A_start <= B_end and
-     *
-     * Or the defined by the
-     * opposite: The two intervals do not intersect iff A_end < B_start or
-     * A_start > B_end.
-     *
-     * To iterate over a two dimensional (end-time x start-time) container
-     * of AirFrames this class iterates over all AirFrame-lists whose end-time
-     * is bigger or equal than the interval start (intersect condition 1) and in
-     * each of these lists iterates over all entries but only stops at and
-     * returns entries which start-time is smaller or equal than the interval
-     * end (intersection condition 2).
+     * @brief Type for a container of AirFrames.
      *
-     * In template form to work as const- and non-const iterator.
+     * Used as out type for "getAirFrames" method.
      */
-    template <class C, class ItMatrix, class ItList>
-    class VEINS_API BaseIntersectionIterator {
-    public:
-        /** @brief Pointer to the matrix holding the intervals.*/
-        C* intervals;
-
-        /** @brief Point in time to start iterating over intersections.*/
-        simtime_t from;
-
-        /** @brief Point in time to end iterating over intersections.*/
-        simtime_t to;
-
-        /** @brief Iterator over AirFrame end times.*/
-        ItMatrix endIt;
-
-        /** @brief Iterator over AirFrame start times.*/
-        ItList startIt;
-
-        /** @brief True if the we are already pointing to the next entry.*/
-        bool alreadyNext;
-
-    public:
-        /**
-         * @brief Creates an iterator for the specified interval at the
-         * specified AirFrameMatrix.
-         */
-        BaseIntersectionIterator(C* airFrames, simtime_t_cref from, simtime_t_cref to)
-            : intervals(airFrames)
-            , from(from)
-            , to(to)
-        {
-            // begin at the smallest end-time-entry fulfilling the intersection
-            // condition 1
-            endIt = intervals->lower_bound(from);
-
-            if (endIt != intervals->end()) {
-                startIt = endIt->second.begin();
-            }
-            // we are already pointing at the first unchecked interval
-            alreadyNext = true;
-        }
+    using AirFrameVector = std::list<AirFrame*>;
 
-        /**
-         * @brief Increases the iterator to the next intersecting AirFrame and
-         * returns a pointer to this AirFrame.
-         */
-        AirFrame* next()
-        {
-            if (endIt == intervals->end()) return nullptr;
-
-            // "alreadyNext" indicates that some previous iterator function has
-            // already increased the intern iterators to a yet unchecked values.
-            // This happens after initialization of the iterator and when an
-            // element is erased.
-            if (alreadyNext)
-                alreadyNext = false;
-            else
-                startIt++;
-
-            while (endIt != intervals->end()) {
-                // while there are entries left at the current end-time
-                while (startIt != endIt->second.end()) {
-                    // check if this entry fulfilles the intersection condition
-                    // 2 (condition 1 is already fulfilled in the constructor by
-                    // the start-value of the end-time-iterator)
-                    if (startIt->first <= to) {
-                        return startIt->second;
-                    }
-                    startIt++;
-                }
-
-                endIt++;
-                if (endIt == intervals->end()) return nullptr;
-
-                startIt = endIt->second.begin();
-            }
-
-            return nullptr;
-        }
+protected:
+    /** @brief An AirFrame on the channel together with its reception interval.*/
+    struct Entry {
+        simtime_t start;
+        simtime_t end;
+        AirFrame* frame;
+        bool active;
     };
 
-    /** @brief Type for a const-iterator over an AirFrame interval matrix.*/
-    typedef BaseIntersectionIterator<const AirFrameMatrix, AirFrameMatrix::const_iterator, AirFrameTimeList::const_iterator> ConstIntersectionIterator;
+    /** @brief Type for the end of a released AirFrame.*/
+    using ReleasedEnd = std::pair<simtime_t, AirFrame*>;
 
     /**
-     * @brief Type for a iterator over an AirFrame interval matrix.
+     * @brief Stores every AirFrame on the channel, ordered by start time.
      *
-     * Extends the const-version by an erase method.
+     * Entries before "head" have already been deleted and are dropped once
+     * they make up most of the buffer.
+     * Inactive entries which ended before the discard horizon (see
+     * getDiscardHorizon()) are no longer needed: they are ignored by all
+     * queries and deleted by the next sweep.
      */
-    class VEINS_API IntersectionIterator : public BaseIntersectionIterator<AirFrameMatrix, AirFrameMatrix::iterator, AirFrameTimeList::iterator> {
-    private:
-        /** @brief Type for shortcut to base class type.*/
-        typedef BaseIntersectionIterator<AirFrameMatrix, AirFrameMatrix::iterator, AirFrameTimeList::iterator> Base;
-
-    public:
-        /**
-         * @brief Creates an iterator for the specified interval at the
-         * specified AirFrameMatrix.
-         */
-        IntersectionIterator(AirFrameMatrix* airFrames, simtime_t_cref from, simtime_t_cref to)
-            : Base(airFrames, from, to)
-        {
-        }
+    std::vector<Entry> entries;
 
-        /**
-         * @brief Erases the AirFrame the iterator currently points to from the
-         * AirFrameMatrix.
-         *
-         * After the erase the iterator points to an invalid value and "next()"
-         * should be called.
-         */
-        void eraseAirFrame()
-        {
-            ASSERT(endIt != intervals->end());
-            ASSERT(startIt != endIt->second.end());
-
-            // erase AirFrame from list
-            startIt = endIt->second.erase(startIt);
-
-            // check if we've deleted the last entry in the list
-            if (startIt == endIt->second.end()) {
-                // check if we deleted the only entry in the list
-                if (endIt->second.empty()) {
-                    intervals->erase(endIt++); // delete list from map
-                }
-                else {
-                    endIt++;
-                }
-
-                // increase to a valid value if we are not done
-                if (endIt != intervals->end()) {
-                    startIt = endIt->second.begin();
-                }
-            }
-            alreadyNext = true;
-        }
-    };
+    /** @brief Index of the first entry which has not been deleted yet.*/
+    size_t head = 0;
 
     /**
-     * @brief Stores the currently active AirFrames.
+     * @brief Index of the first active entry (or the end of the buffer).
      *
-     * This means every AirFrame which was added but not yet removed.
+     * Every entry before it is inactive.
      */
-    AirFrameMatrix activeAirFrames;
+    size_t firstActive = 0;
 
     /**
-     * @brief Stores inactive AirFrames.
+     * @brief Position of every active AirFrame in the buffer, counting the
+     * entries dropped from its front (see numDropped).
      *
-     * This means every AirFrame which has been already removed but still is
-     * needed because it intersect with one or more active AirFrames.
+     * Active entries are never moved by a sweep, so these only go stale when
+     * entries are dropped.
+     */
+    std::unordered_map<const AirFrame*, size_t> activePositions;
+
+    /** @brief Number of entries dropped from the front of the buffer so far.*/
+    size_t numDropped = 0;
+
+    /** @brief Number of active AirFrames.*/
+    size_t numActive = 0;
+
+    /**
+     * @brief Number of inactive entries in front of the first active entry
+     * after which the next sweep deletes all entries which are no longer needed.
      */
-    AirFrameMatrix inactiveAirFrames;
+    size_t sweepThreshold = minSweepThreshold;
 
-    /** @brief Type for a map of AirFrame pointers to their start time.*/
-    typedef std::map<AirFrame*, simtime_t> AirFrameStartMap;
+    /** @brief Smallest value of sweepThreshold.*/
+    static const size_t minSweepThreshold = 32;
 
-    /** @brief Stores the start time of every AirFrame.*/
-    AirFrameStartMap airFrameStarts;
+    /** @brief Longest duration of all AirFrames in the buffer (may be outdated towards longer durations).*/
+    simtime_t maxDuration;
 
     /** @brief Stores the point in history up to which we have some (but not
      * necessarily all) channel information stored.*/
@@ -266,13 +158,11 @@ protected:
      * information stored.*/
     simtime_t recordStartTime;
 
-public:
-    /**
-     * @brief Type for a container of AirFrames.
-     *
-     * Used as out type for "getAirFrames" method.
-     */
-    using AirFrameVector = std::list<AirFrame*>;
+    /** @brief The latest start or end of an AirFrame ChannelInfo has been told about.*/
+    simtime_t currentTime;
+
+    /** @brief Ends of the released AirFrames which are still active, earliest first.*/
+    std::priority_queue<ReleasedEnd, std::vector<ReleasedEnd>, std::greater<ReleasedEnd>> releasedEnds;
 
 protected:
     /**
@@ -282,92 +172,86 @@ protected:
     void assertNoIntersections();
 
     /**
-     * @brief Returns every AirFrame of an AirFrameMatrix which intersect with a
-     * given interval.
+     * @brief Returns the point in time before which an inactive AirFrame has to
+     * end to be no longer needed, i.e., to neither intersect with an active
+     * AirFrame nor with the time we started recording.
      *
-     * The intersecting AirFrames are stored in the AirFrameVector reference
-     * passed as parameter.
+     * Returns SimTime::getMaxTime() if neither any AirFrame is active nor
+     * ChannelInfo is recording.
      */
-    void getIntersections(const AirFrameMatrix& airFrames, simtime_t_cref from, simtime_t_cref to, AirFrameVector& outVector) const;
+    simtime_t getDiscardHorizon() const
+    {
+        simtime_t horizon = firstActive < entries.size() ? entries[firstActive].start : SimTime::getMaxTime();
+        if (recordStartTime > -1 && recordStartTime < horizon) {
+            horizon = recordStartTime;
+        }
+        return horizon;
+    }
 
     /**
-     * @brief Returns true if there is at least one AirFrame in the passed
-     * AirFrameMatrix which intersect with the given interval.
+     * @brief Returns true if the passed entry is still needed, given the
+     * current discard horizon.
      */
-    bool isIntersecting(const AirFrameMatrix& airFrames, simtime_t_cref from, simtime_t_cref to) const;
+    static bool isNeeded(const Entry& entry, simtime_t_cref horizon)
+    {
+        return entry.active || entry.end >= horizon;
+    }
 
     /**
-     * @brief Moves a previously active AirFrame to the inactive AirFrames.
-     *
-     * This methods checks if there are some inactive AirFrames which can be
-     * deleted because the AirFrame to in-activate was the last one they
-     * intersected with.
-     * It also checks if the AirFrame to in-activate still intersect with at
-     * least one active AirFrame before it is moved to inactive AirFrames.
+     * @brief Returns the index of the passed active AirFrame in constant time.
      */
-    void addToInactives(AirFrame* a, simtime_t_cref startTime, simtime_t_cref endTime);
+    size_t findActive(AirFrame* frame) const;
 
     /**
-     * @brief Deletes an AirFrame from an AirFrameMatrix.
+     * @brief Marks the active AirFrame at the passed index as inactive.
      */
-    void deleteAirFrame(AirFrameMatrix& airFrames, AirFrame* a, simtime_t_cref startTime, simtime_t_cref endTime);
+    void deactivate(size_t index);
 
     /**
-     * @brief Returns the start time of the odlest AirFrame on the channel.
+     * @brief Tells ChannelInfo about the passed point in time and removes the
+     * released AirFrames which ended until then.
+     *
+     * @return true if any released AirFrame has been removed.
      */
-    simtime_t findEarliestInfoPoint();
+    bool advanceTo(simtime_t_cref time);
 
     /**
-     * @brief Checks if any information inside the passed interval can be
-     * discarded.
-     *
-     * This method should be called every time the information for a certain
-     * interval changes (AirFrame is removed or record time changed).
+     * @brief Deletes the AirFrames which are no longer needed and updates the
+     * earliest info point.
      *
-     * @param startTime The start of the interval to check
-     * @param endTime The end of the interval to check
+     * AirFrames at the front of the buffer are deleted right away, all others
+     * only once enough of them have accumulated in front of the first active
+     * AirFrame (or once no AirFrame is active anymore).
      */
-    void checkAndCleanInterval(simtime_t_cref startTime, simtime_t_cref endTime);
+    void discardUnneeded();
 
     /**
-     * @brief Returns true if all information inside the passed interval can be
-     * deleted.
-     *
-     * For example this method is used to check if information for the duration
-     * of an AirFrame is needed anymore and if not the AirFrame is deleted.
-     *
-     * @param startTime The start time of the interval (e.g. AirFrame start)
-     * @param endTime The end time of the interval (e.g. AirFrame end)
-     * @return returns true if any information for the passed interval can be
-     * discarded.
+     * @brief Deletes every AirFrame which is no longer needed and compacts the
+     * buffer.
      */
-    bool canDiscardInterval(simtime_t_cref startTime, simtime_t_cref endTime);
+    void sweep();
 
     /**
-     * @brief Checks if any information up from the passed start time can be
-     * discarded.
-     *
-     * @param start The start of the interval to check
+     * @brief Returns the start time of the odlest AirFrame on the channel.
      */
-    void checkAndCleanFrom(simtime_t_cref start)
-    {
-        // nothing to do
-        if (inactiveAirFrames.empty()) return;
-
-        // take last ended inactive airframe as end of interval
-        checkAndCleanInterval(start, inactiveAirFrames.rbegin()->first);
-    }
+    simtime_t findEarliestInfoPoint();
 
 public:
     ChannelInfo()
         : earliestInfoPoint(-1)
         , recordStartTime(-1)
+        , currentTime(-1)
     {
     }
 
-    virtual ~ChannelInfo()
-    {
-    }
+    /**
+     * @brief Deletes the AirFrames which are no longer needed but have not been
+     * deleted yet.
+     *
+     * All other AirFrames have to be taken care of by the owner of the
+     * ChannelInfo (see BasePhyLayer::~BasePhyLayer()).
+     */
+    virtual ~ChannelInfo();
 
     /**
      * @brief Tells the ChannelInfo that an AirFrame has started.
@@ -389,10 +273,22 @@ public:
      */
     simtime_t removeAirFrame(AirFrame* a);
 
+    /**
+     * @brief Tells the ChannelInfo that an active AirFrame only matters as
+     * interference from now on and will not be removed.
+     *
+     * ChannelInfo keeps the AirFrame active until it is told about a point in
+     * time at or after the end of the AirFrame (i.e., when another AirFrame
+     * is added or removed) and then treats it as if it had been removed.
+     */
+    void releaseAirFrame(AirFrame* a);
+
     /**
      * @brief Fills the passed AirFrameVector reference with the AirFrames which
      * intersect with the given time interval.
      *
+     * The AirFrames are returned in the order they started.
+     *
      * Note: Completeness of the list of AirFrames for specific interval can
      * only be assured if start and end point of the interval lies inside the
      * duration of at least one currently active AirFrame.
@@ -428,14 +324,8 @@ public:
      */
     void startRecording(simtime_t_cref start)
     {
-        // clean up until old record start
-        if (recordStartTime > -1) {
-            recordStartTime = start;
-            checkAndCleanInterval(0, recordStartTime);
-        }
-        else {
-            recordStartTime = start;
-        }
+        recordStartTime = start;
+        discardUnneeded();
     }
 
     /**
@@ -447,9 +337,8 @@ public:
     void stopRecording()
     {
         if (recordStartTime > -1) {
-            simtime_t old = recordStartTime;
             recordStartTime = -1;
-            checkAndCleanFrom(old);
+            discardUnneeded();
         }
     }
 
@@ -468,9 +357,8 @@ public:
      */
     bool isChannelEmpty() const
     {
-        ASSERT(recordStartTime != -1 || activeAirFrames.empty() == airFrameStarts.empty());
-
-        return airFrameStarts.empty();
+        // without active AirFrames, discardUnneeded() leaves only needed AirFrames in the buffer
+        return head == entries.size();
     }
 };
 
@@ -108,6 +108,18 @@ public:
      */
     virtual simtime_t processSignal(AirFrame* frame);
 
+    /**
+     * @brief Returns true if the passed AirFrame, which processSignal() does
+     * not want to be passed again, only matters as interference from now on.
+     *
+     * The phy layer then releases the AirFrame right away instead of handling
+     * its end, so the Decider never sees it again.
+     */
+    virtual bool isInterferenceOnly(AirFrame* frame)
+    {
+        return false;
+    }
+
     /**
      * @brief Method to be called by an OMNeT-module during its own finish(),
      * to enable a decider to do some things.
@@ -33,6 +33,8 @@ namespace veins {
 
 class AirFrame;
 
+class InterferenceTracker;
+
 class BaseWorldUtility;
 
 /**
@@ -72,6 +74,16 @@ public:
      */
     virtual void getChannelInfo(simtime_t_cref from, simtime_t_cref to, AirFrameVector& out) = 0;
 
+    /**
+     * @brief Returns the InterferenceTracker keeping the summed power on the
+     * channel up to date, or nullptr if the Decider has to compute it from
+     * getChannelInfo() itself.
+     */
+    virtual InterferenceTracker* getInterferenceTracker()
+    {
+        return nullptr;
+    }
+
     /**
      * @brief Returns a constant which defines the noise floor in
      * the passed time frame (in mW).
@@ -0,0 +1,171 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/phyLayer/InterferenceTracker.h"
+
+#include <algorithm>
+
+#include "veins/base/toolbox/SignalKernels.h"
+
+using namespace veins;
+
+void InterferenceTracker::addAirFrame(AirFrame* frame, simtime_t_cref now)
+{
+    Signal& signal = frame->getSignal();
+    ASSERT(signal.getReceptionStart() == now);
+
+    retireUntil(now);
+
+    signal.applyAllAnalogueModels();
+    if (activeSignals.empty()) {
+        power = Signal(signal.getSpectrum());
+        dataPower = Signal(signal.getSpectrum());
+        dataCount = Signal(signal.getSpectrum());
+    }
+    ASSERT(power.getSpectrum() == signal.getSpectrum());
+
+    ActiveSignal active{signal.getReceptionEnd(), signal, dataSignalOf(signal)};
+    power += active.signal;
+    dataPower += active.dataSignal;
+    countDataChannels(signal, 1);
+    activeSignals.push(std::move(active));
+    trackedStarts.insert(now);
+
+    recordStep(now);
+}
+
+void InterferenceTracker::removeAirFrame(AirFrame* frame, simtime_t_cref now)
+{
+    const Signal& signal = frame->getSignal();
+    ASSERT(signal.getReceptionStart() <= now);
+
+    retireUntil(now);
+
+    auto it = trackedStarts.find(signal.getReceptionStart());
+    ASSERT(it != trackedStarts.end());
+    trackedStarts.erase(it);
+
+    // keep the history back to the step valid at the earliest start of any still tracked AirFrame
+    simtime_t earliest = trackedStarts.empty() ? now : *trackedStarts.begin();
+    while (dataPowerSteps.size() > 1 && dataPowerSteps[1].time <= earliest) {
+        dataPowerSteps.pop_front();
+    }
+}
+
+bool InterferenceTracker::isChannelPowerBelowThreshold(simtime_t_cref now, double frequency, double threshold, AirFrame* exclude)
+{
+    retireUntil(now);
+
+    if (activeSignals.empty()) return true;
+
+    size_t freqIndex = power.getSpectrum().indexOf(frequency);
+    double sum = power.at(freqIndex);
+    if (exclude != nullptr) {
+        const Signal& excluded = exclude->getSignal();
+        if (excluded.getReceptionStart() <= now && excluded.getReceptionEnd() > now) {
+            sum -= excluded.at(freqIndex);
+        }
+    }
+    return sum < threshold;
+}
+
+double InterferenceTracker::getMinSINR(simtime_t_cref start, simtime_t_cref end, AirFrame* signalFrame, double noise)
+{
+    const Signal& signal = signalFrame->getSignal();
+    ASSERT(start >= signal.getReceptionStart());
+    ASSERT(end <= signal.getReceptionEnd());
+
+    retireUntil(end);
+
+    const size_t dataStart = signal.getDataStart();
+    const size_t numDataValues = signal.getNumDataValues();
+    const double* ownPower = signal.getDataValues();
+
+    // find the step valid at start, then take the maximum of all steps until end
+    auto step = std::upper_bound(dataPowerSteps.begin(), dataPowerSteps.end(), start, [](simtime_t_cref time, const Step& entry) { return time < entry.time; });
+    if (step != dataPowerSteps.begin()) --step;
+
+    interference.assign(numDataValues, 0);
+    for (; step != dataPowerSteps.end() && step->time < end; ++step) {
+        for (size_t i = 0; i < numDataValues; i++) {
+            // the Signal itself is active during the whole interval, so there is no interference where it is the only one
+            if (step->dataCount.at(dataStart + i) <= 1) continue;
+            interference[i] = std::max(interference[i], step->dataPower.at(dataStart + i));
+        }
+    }
+
+    // the Signal itself was part of the summed power during the whole interval
+    for (size_t i = 0; i < numDataValues; i++) {
+        interference[i] = std::max(interference[i] - ownPower[i], 0.0);
+    }
+
+    return SignalKernels::minSinr(ownPower, interference.data(), noise, numDataValues);
+}
+
+void InterferenceTracker::retireUntil(simtime_t_cref now)
+{
+    while (!activeSignals.empty() && activeSignals.top().end <= now) {
+        const ActiveSignal& active = activeSignals.top();
+        simtime_t end = active.end;
+        power -= active.signal;
+        dataPower -= active.dataSignal;
+        countDataChannels(active.signal, -1);
+        activeSignals.pop();
+
+        // start over from exact zeros, so rounding errors do not pile up
+        if (activeSignals.empty()) {
+            power = 0;
+        }
+        recordStep(end);
+    }
+}
+
+void InterferenceTracker::recordStep(simtime_t_cref time)
+{
+    if (!dataPowerSteps.empty() && dataPowerSteps.back().time == time) {
+        dataPowerSteps.back().dataPower = dataPower;
+        dataPowerSteps.back().dataCount = dataCount;
+    }
+    else {
+        ASSERT(dataPowerSteps.empty() || dataPowerSteps.back().time < time);
+        dataPowerSteps.push_back({time, dataPower, dataCount});
+    }
+}
+
+Signal InterferenceTracker::dataSignalOf(const Signal& signal)
+{
+    Signal dataSignal(signal.getSpectrum());
+    for (size_t i = signal.getDataStart(); i < signal.getDataEnd(); i++) {
+        dataSignal.at(i) = signal.at(i);
+    }
+    return dataSignal;
+}
+
+void InterferenceTracker::countDataChannels(const Signal& signal, double delta)
+{
+    for (size_t i = signal.getDataStart(); i < signal.getDataEnd(); i++) {
+        dataCount.at(i) += delta;
+        // drop rounding errors once no Signal is left on this channel
+        if (dataCount.at(i) == 0) dataPower.at(i) = 0;
+    }
+}
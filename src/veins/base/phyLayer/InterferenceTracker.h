@@ -0,0 +1,145 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <deque>
+#include <queue>
+#include <set>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/base/messages/AirFrame_m.h"
+#include "veins/base/toolbox/Signal.h"
+
+namespace veins {
+
+/**
+ * @brief Keeps the summed power of all AirFrames on the channel up to date as AirFrames start and end.
+ *
+ * Answers the same questions as SignalUtils::isChannelPowerBelowThreshold() and SignalUtils::getMinSINR(),
+ * but from the maintained sums instead of from a list of AirFrames.
+ * To do so, it applies all analogue models to an AirFrame's Signal as soon as the AirFrame is added.
+ *
+ * InterferenceTracker is a passive class like ChannelInfo: the BasePhyLayer has to tell it when an AirFrame
+ * starts (addAirFrame()) and when it is done with it (removeAirFrame()). An AirFrame stops contributing
+ * to the summed power at its reception end, regardless of when it is removed.
+ * AirFrames have to be added chronologically and queries may only refer to the past.
+ *
+ * @ingroup phyLayer
+ */
+class VEINS_API InterferenceTracker {
+public:
+    /**
+     * @brief Starts tracking the passed AirFrame, which begins at now.
+     */
+    void addAirFrame(AirFrame* frame, simtime_t_cref now);
+
+    /**
+     * @brief Stops tracking the passed AirFrame.
+     *
+     * If the AirFrame has not ended by now, it keeps contributing to the summed power until its reception end,
+     * but can no longer be queried itself.
+     * Afterwards, intervals before the earliest start of any still tracked AirFrame can no longer be queried.
+     */
+    void removeAirFrame(AirFrame* frame, simtime_t_cref now);
+
+    /**
+     * @brief Returns whether the summed power at frequency is below threshold at time now, ignoring exclude.
+     *
+     * @see SignalUtils::isChannelPowerBelowThreshold()
+     */
+    bool isChannelPowerBelowThreshold(simtime_t_cref now, double frequency, double threshold, AirFrame* exclude = nullptr);
+
+    /**
+     * @brief Returns the minimal SINR at any data channel of signalFrame's Signal during [start, end).
+     *
+     * Interference is the largest summed power on each data channel during [start, end),
+     * counting each other AirFrame on its own data channels only.
+     *
+     * @see SignalUtils::getMinSINR()
+     */
+    double getMinSINR(simtime_t_cref start, simtime_t_cref end, AirFrame* signalFrame, double noise);
+
+protected:
+    /** @brief A Signal contributing to the summed power until its reception end. */
+    struct ActiveSignal {
+        simtime_t end;
+        Signal signal;
+        Signal dataSignal;
+    };
+
+    /** @brief The summed data power (and how many Signals it sums up), valid from time until the next step. */
+    struct Step {
+        simtime_t time;
+        Signal dataPower;
+        Signal dataCount;
+    };
+
+    struct laterEnd {
+        bool operator()(const ActiveSignal& lhs, const ActiveSignal& rhs) const
+        {
+            return lhs.end > rhs.end;
+        }
+    };
+
+    /**
+     * @brief Stops counting all Signals with a reception end of at most now.
+     */
+    void retireUntil(simtime_t_cref now);
+
+    /**
+     * @brief Records the current summed data power as being valid from time on.
+     */
+    void recordStep(simtime_t_cref time);
+
+    /** @brief Returns the passed Signal restricted to its data channels. */
+    static Signal dataSignalOf(const Signal& signal);
+
+    /** @brief Adds delta to the count of each data channel of the passed Signal. */
+    void countDataChannels(const Signal& signal, double delta);
+
+    /** @brief Signals that still contribute to the summed power, ordered by reception end. */
+    std::priority_queue<ActiveSignal, std::vector<ActiveSignal>, laterEnd> activeSignals;
+
+    /** @brief Summed power of all active Signals. */
+    Signal power;
+
+    /** @brief Summed power of all active Signals, each restricted to its data channels. */
+    Signal dataPower;
+
+    /** @brief Number of active Signals on each data channel. */
+    Signal dataCount;
+
+    /** @brief History of dataPower, oldest first. */
+    std::deque<Step> dataPowerSteps;
+
+    /** @brief Reception starts of all AirFrames added but not yet removed. */
+    std::multiset<simtime_t> trackedStarts;
+
+    /** @brief Scratch space for the interference on the data channels of a Signal. */
+    std::vector<double> interference;
+};
+
+} // namespace veins
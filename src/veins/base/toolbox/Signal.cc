@@ -22,9 +22,12 @@
 
 #include "veins/base/toolbox/Signal.h"
 
+#include <algorithm>
 #include <sstream>
+#include <stdexcept>
 
 #include "veins/base/phyLayer/AnalogueModel.h"
+#include "veins/base/toolbox/SignalKernels.h"
 
 namespace veins {
 
@@ -47,19 +50,48 @@ Signal::Signal(const Signal& other)
 
 Signal::Signal(Spectrum spec)
     : spectrum(spec)
-    , values(spectrum.getNumFreqs(), 0)
+    , values(spectrum.getNumFreqs())
 {
 }
 
 Signal::Signal(Spectrum spec, simtime_t start, simtime_t dur)
     : spectrum(spec)
-    , values(spectrum.getNumFreqs(), 0)
+    , values(spectrum.getNumFreqs())
     , timingUsed(true)
     , sendingStart(start)
     , duration(dur)
 {
 }
 
+Signal::Values::Values(size_t count)
+    : count(count)
+{
+    if (count > inlineCapacity) {
+        shared = std::make_shared<std::vector<double>>(count, 0);
+    }
+}
+
+double* Signal::Values::mutableData()
+{
+    if (!shared) return count > 0 ? local.data() : nullptr;
+    if (shared.use_count() > 1) {
+        shared = std::make_shared<std::vector<double>>(*shared);
+    }
+    return shared->data();
+}
+
+const double& Signal::Values::at(size_t index) const
+{
+    if (index >= count) throw std::out_of_range("Signal value index out of range");
+    return data()[index];
+}
+
+double& Signal::Values::mutableAt(size_t index)
+{
+    if (index >= count) throw std::out_of_range("Signal value index out of range");
+    return mutableData()[index];
+}
+
 const Spectrum& Signal::getSpectrum() const
 {
     return spectrum;
@@ -67,7 +99,7 @@ const Spectrum& Signal::getSpectrum() const
 
 double& Signal::at(size_t index)
 {
-    return values.at(index);
+    return values.mutableAt(index);
 }
 
 const double& Signal::at(size_t index) const
@@ -78,7 +110,7 @@ const double& Signal::at(size_t index) const
 double& Signal::atFrequency(double frequency)
 {
     size_t index = spectrum.indexOf(frequency);
-    return values.at(index);
+    return values.mutableAt(index);
 }
 
 const double& Signal::atFrequency(double frequency) const
@@ -88,6 +120,11 @@ const double& Signal::atFrequency(double frequency) const
 }
 
 double* Signal::getValues()
+{
+    return values.mutableData();
+}
+
+const double* Signal::getValues() const
 {
     return values.data();
 }
@@ -104,7 +141,7 @@ double Signal::getMax() const
 
 double& Signal::dataAt(size_t index)
 {
-    return values.at(dataOffset + index);
+    return values.mutableAt(dataOffset + index);
 }
 
 const double& Signal::dataAt(size_t index) const
@@ -123,6 +160,11 @@ size_t Signal::getDataEnd() const
 }
 
 double* Signal::getDataValues()
+{
+    return values.mutableData() + dataOffset;
+}
+
+const double* Signal::getDataValues() const
 {
     return values.data() + dataOffset;
 }
@@ -169,7 +211,7 @@ size_t Signal::getCenterFrequencyIndex() const
 
 double Signal::getAtCenterFrequency() const
 {
-    return values[centerFrequencyIndex];
+    return values.data()[centerFrequencyIndex];
 }
 
 void Signal::setCenterFrequencyIndex(size_t index)
@@ -179,7 +221,7 @@ void Signal::setCenterFrequencyIndex(size_t index)
 
 bool Signal::greaterAtCenterFrequency(double threshold)
 {
-    if (values[centerFrequencyIndex] < threshold) return false;
+    if (values.data()[centerFrequencyIndex] < threshold) return false;
 
     uint16_t maxAnalogueModels = analogueModelList->size();
 
@@ -188,14 +230,14 @@ bool Signal::greaterAtCenterFrequency(double threshold)
         (*analogueModelList)[numAnalogueModelsApplied]->filterSignal(this);
         numAnalogueModelsApplied++;
 
-        if (values[centerFrequencyIndex] < threshold) return false;
+        if (values.data()[centerFrequencyIndex] < threshold) return false;
     }
     return true;
 }
 
 bool Signal::smallerAtCenterFrequency(double threshold)
 {
-    if (values[centerFrequencyIndex] < threshold) return true;
+    if (values.data()[centerFrequencyIndex] < threshold) return true;
 
     uint16_t maxAnalogueModels = analogueModelList->size();
 
@@ -204,7 +246,7 @@ bool Signal::smallerAtCenterFrequency(double threshold)
         (*analogueModelList)[numAnalogueModelsApplied]->filterSignal(this);
         numAnalogueModelsApplied++;
 
-        if (values[centerFrequencyIndex] < threshold) return true;
+        if (values.data()[centerFrequencyIndex] < threshold) return true;
     }
     return false;
 }
@@ -244,6 +286,39 @@ void Signal::applyAllAnalogueModels()
     }
 }
 
+void Signal::applyAnalogueModel(const std::vector<Signal*>& signals, uint16_t index)
+{
+    if (signals.empty()) return;
+
+    AnalogueModelList* list = signals.front()->analogueModelList;
+    if (index >= list->size()) return;
+
+    std::vector<Signal*> pending;
+    for (auto signal : signals) {
+        ASSERT(signal->analogueModelList == list);
+        if (index < signal->numAnalogueModelsApplied) continue;
+        // the same Signal may be passed more than once (e.g., as signal and as interferer), but must only be filtered once
+        if (std::find(pending.begin(), pending.end(), signal) != pending.end()) continue;
+        pending.push_back(signal);
+    }
+    if (pending.empty()) return;
+
+    (*list)[index]->filterSignals(pending);
+    for (auto signal : pending) {
+        signal->numAnalogueModelsApplied++;
+    }
+}
+
+void Signal::applyAllAnalogueModels(const std::vector<Signal*>& signals)
+{
+    if (signals.empty()) return;
+
+    uint16_t maxAnalogueModels = signals.front()->analogueModelList->size();
+    for (uint16_t index = 0; index < maxAnalogueModels; ++index) {
+        applyAnalogueModel(signals, index);
+    }
+}
+
 POA Signal::getSenderPoa() const
 {
     return senderPoa;
@@ -313,7 +388,8 @@ void Signal::setTiming(simtime_t start, simtime_t dur)
 
 Signal& Signal::operator=(const double value)
 {
-    std::fill(values.begin(), values.end(), value);
+    double* v = values.mutableData();
+    std::fill(v, v + values.size(), value);
     return *this;
 }
 
@@ -321,7 +397,7 @@ Signal& Signal::operator=(const Signal& other)
 {
     if (this == &other) return *this;
 
-    spectrum = other.getSpectrum();
+    spectrum = other.spectrum;
 
     dataOffset = other.getDataOffset();
 
@@ -349,13 +425,13 @@ Signal& Signal::operator+=(const Signal& other)
     ASSERT(this->getSpectrum() == other.getSpectrum());
     ASSERT(!(this->timingUsed && other.timingUsed) || (this->sendingStart == other.sendingStart && this->duration == other.duration));
 
-    std::transform(values.begin(), values.end(), other.values.begin(), values.begin(), std::plus<double>());
+    SignalKernels::add(values.mutableData(), other.values.data(), values.size());
     return *this;
 }
 
 Signal& Signal::operator+=(const double value)
 {
-    std::transform(values.begin(), values.end(), values.begin(), [value](double other) { return other + value; });
+    SignalKernels::add(values.mutableData(), value, values.size());
     return *this;
 }
 
@@ -364,13 +440,13 @@ Signal& Signal::operator-=(const Signal& other)
     ASSERT(this->getSpectrum() == other.getSpectrum());
     ASSERT(!(this->timingUsed && other.timingUsed) || (this->sendingStart == other.sendingStart && this->duration == other.duration));
 
-    std::transform(values.begin(), values.end(), other.values.begin(), values.begin(), std::minus<double>());
+    SignalKernels::subtract(values.mutableData(), other.values.data(), values.size());
     return *this;
 }
 
 Signal& Signal::operator-=(const double value)
 {
-    std::transform(values.begin(), values.end(), values.begin(), [value](double other) { return other - value; });
+    SignalKernels::subtract(values.mutableData(), value, values.size());
     return *this;
 }
 
@@ -379,13 +455,13 @@ Signal& Signal::operator*=(const Signal& other)
     ASSERT(this->getSpectrum() == other.getSpectrum());
     ASSERT(!(this->timingUsed && other.timingUsed) || (this->sendingStart == other.sendingStart && this->duration == other.duration));
 
-    std::transform(values.begin(), values.end(), other.values.begin(), values.begin(), std::multiplies<double>());
+    SignalKernels::multiply(values.mutableData(), other.values.data(), values.size());
     return *this;
 }
 
 Signal& Signal::operator*=(const double value)
 {
-    std::transform(values.begin(), values.end(), values.begin(), [value](double other) { return other * value; });
+    SignalKernels::multiply(values.mutableData(), value, values.size());
     return *this;
 }
 
@@ -394,13 +470,13 @@ Signal& Signal::operator/=(const Signal& other)
     ASSERT(this->getSpectrum() == other.getSpectrum());
     ASSERT(!(this->timingUsed && other.timingUsed) || (this->sendingStart == other.sendingStart && this->duration == other.duration));
 
-    std::transform(values.begin(), values.end(), other.values.begin(), values.begin(), std::divides<double>());
+    SignalKernels::divide(values.mutableData(), other.values.data(), values.size());
     return *this;
 }
 
 Signal& Signal::operator/=(const double value)
 {
-    std::transform(values.begin(), values.end(), values.begin(), [value](double other) { return other / value; });
+    SignalKernels::divide(values.mutableData(), value, values.size());
     return *this;
 }
 
@@ -495,11 +571,11 @@ std::ostream& operator<<(std::ostream& os, const Signal& s)
     }
     os << s.spectrum << ", ";
     std::ostringstream ss;
-    for (auto&& value : s.values) {
+    for (size_t i = 0; i < s.values.size(); i++) {
         if (ss.tellp() != 0) {
             ss << ", ";
         }
-        ss << value;
+        ss << s.values.data()[i];
     }
     os << ss.str();
     os << ")";
@@ -521,12 +597,12 @@ simtime_t calculateDuration(const Signal& lhs, const Signal& rhs)
 
 double Signal::getMinInRange(size_t freqIndexLow, size_t freqIndexHigh) const
 {
-    return *(std::min_element(values.begin() + freqIndexLow, values.begin() + freqIndexHigh));
+    return SignalKernels::min(values.data() + freqIndexLow, freqIndexHigh - freqIndexLow);
 }
 
 double Signal::getMaxInRange(size_t freqIndexLow, size_t freqIndexHigh) const
 {
-    return *(std::max_element(values.begin() + freqIndexLow, values.begin() + freqIndexHigh));
+    return SignalKernels::max(values.data() + freqIndexLow, freqIndexHigh - freqIndexLow);
 }
 
 } // namespace veins
@@ -22,6 +22,10 @@
 
 #pragma once
 
+#include <array>
+#include <memory>
+#include <vector>
+
 #include "veins/veins.h"
 
 #include "veins/base/utils/POA.h"
@@ -38,6 +42,11 @@ namespace veins {
  * The signal power is stored in milliwatt.
  * Signals can be combined arithmetically to, e.g., compute interference introduced by several overlapping signals.
  *
+ * Power values of small spectra (such as the one used for IEEE 802.11p) are stored inline, so copying a Signal does not allocate.
+ * Power values of larger spectra are shared between copies of a Signal until one of them is modified (copy-on-write).
+ * This makes fanning out an AirFrame to many receivers cheap: only receivers that actually apply attenuation pay for a copy of the values.
+ * References and pointers obtained from non-const accessors are therefore only valid until this Signal is copied.
+ *
  * @see SignalUtils
  * @see Spectrum
  */
@@ -110,6 +119,13 @@ public:
      */
     double* getValues();
 
+    /**
+     * Access the underlying power values directly (read-only).
+     *
+     * @see getNumValues()
+     */
+    const double* getValues() const;
+
     /**
      * Returns the number of power values stored in this signal.
      *
@@ -162,6 +178,13 @@ public:
      */
     double* getDataValues();
 
+    /**
+     * Access the underlying data range power levels directly (read-only).
+     *
+     * @see getNumDataValues()
+     */
+    const double* getDataValues() const;
+
     /**
      * The number of values in the data frequency subrange.
      */
@@ -286,6 +309,27 @@ public:
      * @see AnalogueModel::filterSignal()
      */
     void applyAllAnalogueModels();
+
+    /**
+     * Apply a specific AnalogueModel to several Signals sharing the same AnalogueModel list.
+     *
+     * Hands all Signals the model has not been applied to yet to the model in one batch.
+     *
+     * @param signals the signals to apply the model to
+     * @param index the index in the analogue model list of the model to be applied
+     *
+     * @see AnalogueModel::filterSignals()
+     */
+    static void applyAnalogueModel(const std::vector<Signal*>& signals, uint16_t index);
+
+    /**
+     * Apply all AnalogueModels to several Signals sharing the same AnalogueModel list.
+     *
+     * Applies one model after the other, each to all Signals in one batch.
+     *
+     * @see AnalogueModel::filterSignals()
+     */
+    static void applyAllAnalogueModels(const std::vector<Signal*>& signals);
     ///@}
 
     /**
@@ -493,9 +537,46 @@ private:
     double getMinInRange(size_t freqIndexLow, size_t freqIndexHigh) const;
     double getMaxInRange(size_t freqIndexLow, size_t freqIndexHigh) const;
 
+    /**
+     * Storage for the power values of a Signal.
+     *
+     * Up to inlineCapacity values are kept in place; more values are kept on the heap and shared between copies until written to.
+     */
+    class Values {
+    public:
+        static constexpr size_t inlineCapacity = 16;
+
+        Values() = default;
+        explicit Values(size_t count);
+
+        size_t size() const
+        {
+            return count;
+        }
+
+        const double* data() const
+        {
+            if (shared) return shared->data();
+            return count > 0 ? local.data() : nullptr;
+        }
+
+        /**
+         * Return the values for writing, detaching them from other Signals first if they are shared.
+         */
+        double* mutableData();
+
+        const double& at(size_t index) const;
+        double& mutableAt(size_t index);
+
+    private:
+        size_t count = 0;
+        std::array<double, inlineCapacity> local{};
+        std::shared_ptr<std::vector<double>> shared;
+    };
+
     Spectrum spectrum;
 
-    std::vector<double> values;
+    Values values;
 
     size_t numDataValues = 0;
     size_t dataOffset = 0;
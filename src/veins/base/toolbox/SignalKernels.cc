@@ -0,0 +1,382 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/toolbox/SignalKernels.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "veins/base/utils/Simd.h"
+
+#if VEINS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+using namespace veins;
+
+namespace {
+
+// every operation provides a scalar implementation and (if available) one per instruction set
+// note: kernels must not contract multiplications and additions, so they yield the same results as the scalar code
+
+struct Add {
+    static double scalar(double a, double b)
+    {
+        return a + b;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_add_pd(a, b);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_add_pd(a, b);
+    }
+#endif
+};
+
+struct Subtract {
+    static double scalar(double a, double b)
+    {
+        return a - b;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_sub_pd(a, b);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_sub_pd(a, b);
+    }
+#endif
+};
+
+struct Multiply {
+    static double scalar(double a, double b)
+    {
+        return a * b;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_mul_pd(a, b);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_mul_pd(a, b);
+    }
+#endif
+};
+
+struct Divide {
+    static double scalar(double a, double b)
+    {
+        return a / b;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_div_pd(a, b);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_div_pd(a, b);
+    }
+#endif
+};
+
+// min and max keep the accumulator (first operand) if the comparison fails, just like the SSE2 and AVX2 instructions
+struct Min {
+    static double scalar(double a, double b)
+    {
+        return b < a ? b : a;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_min_pd(b, a);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_min_pd(b, a);
+    }
+#endif
+};
+
+struct Max {
+    static double scalar(double a, double b)
+    {
+        return b > a ? b : a;
+    }
+#if VEINS_SIMD_X86
+    VEINS_SIMD_TARGET_SSE2 static __m128d sse2(__m128d a, __m128d b)
+    {
+        return _mm_max_pd(b, a);
+    }
+    VEINS_SIMD_TARGET_AVX2 static __m256d avx2(__m256d a, __m256d b)
+    {
+        return _mm256_max_pd(b, a);
+    }
+#endif
+};
+
+#if VEINS_SIMD_X86
+template <typename Op>
+VEINS_SIMD_TARGET_SSE2 size_t applySse2(double* dst, const double* src, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(dst + i, Op::sse2(_mm_loadu_pd(dst + i), _mm_loadu_pd(src + i)));
+    }
+    return i;
+}
+
+template <typename Op>
+VEINS_SIMD_TARGET_AVX2 size_t applyAvx2(double* dst, const double* src, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(dst + i, Op::avx2(_mm256_loadu_pd(dst + i), _mm256_loadu_pd(src + i)));
+    }
+    return i;
+}
+
+template <typename Op>
+VEINS_SIMD_TARGET_SSE2 size_t applySse2(double* dst, double value, size_t n)
+{
+    const __m128d v = _mm_set1_pd(value);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(dst + i, Op::sse2(_mm_loadu_pd(dst + i), v));
+    }
+    return i;
+}
+
+template <typename Op>
+VEINS_SIMD_TARGET_AVX2 size_t applyAvx2(double* dst, double value, size_t n)
+{
+    const __m256d v = _mm256_set1_pd(value);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(dst + i, Op::avx2(_mm256_loadu_pd(dst + i), v));
+    }
+    return i;
+}
+#endif
+
+inline double elementAt(const double* src, size_t i)
+{
+    return src[i];
+}
+
+inline double elementAt(double value, size_t)
+{
+    return value;
+}
+
+/**
+ * Applies Op to dst and src (either an array or a single value), element by element.
+ */
+template <typename Op, typename Source>
+void apply(double* dst, Source src, size_t n)
+{
+    size_t done = 0;
+#if VEINS_SIMD_X86
+    switch (simd::getInstructionSet()) {
+    case simd::InstructionSet::avx2:
+        done = applyAvx2<Op>(dst, src, n);
+        break;
+    case simd::InstructionSet::sse2:
+        done = applySse2<Op>(dst, src, n);
+        break;
+    case simd::InstructionSet::scalar:
+        break;
+    }
+#endif
+    for (size_t i = done; i < n; ++i) {
+        dst[i] = Op::scalar(dst[i], elementAt(src, i));
+    }
+}
+
+#if VEINS_SIMD_X86
+// reductions keep one accumulator per lane, which only works for operations where the order of evaluation does not matter (such as min and max)
+
+template <typename Op>
+VEINS_SIMD_TARGET_SSE2 double reduceSse2(const double* values, size_t n, double init, size_t& done)
+{
+    __m128d acc = _mm_set1_pd(init);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        acc = Op::sse2(acc, _mm_loadu_pd(values + i));
+    }
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    done = i;
+    return Op::scalar(lanes[0], lanes[1]);
+}
+
+template <typename Op>
+VEINS_SIMD_TARGET_AVX2 double reduceAvx2(const double* values, size_t n, double init, size_t& done)
+{
+    __m256d acc = _mm256_set1_pd(init);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = Op::avx2(acc, _mm256_loadu_pd(values + i));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    done = i;
+    return Op::scalar(Op::scalar(lanes[0], lanes[1]), Op::scalar(lanes[2], lanes[3]));
+}
+#endif
+
+template <typename Op>
+double reduce(const double* values, size_t n, double init)
+{
+    double result = init;
+    size_t done = 0;
+#if VEINS_SIMD_X86
+    switch (simd::getInstructionSet()) {
+    case simd::InstructionSet::avx2:
+        result = reduceAvx2<Op>(values, n, init, done);
+        break;
+    case simd::InstructionSet::sse2:
+        result = reduceSse2<Op>(values, n, init, done);
+        break;
+    case simd::InstructionSet::scalar:
+        break;
+    }
+#endif
+    for (size_t i = done; i < n; ++i) {
+        result = Op::scalar(result, values[i]);
+    }
+    return result;
+}
+
+#if VEINS_SIMD_X86
+VEINS_SIMD_TARGET_SSE2 double minSinrSse2(const double* signal, const double* interference, double noise, size_t n, size_t& done)
+{
+    const __m128d vnoise = _mm_set1_pd(noise);
+    __m128d acc = _mm_set1_pd(std::numeric_limits<double>::infinity());
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d sinr = _mm_div_pd(_mm_loadu_pd(signal + i), _mm_add_pd(_mm_loadu_pd(interference + i), vnoise));
+        acc = Min::sse2(acc, sinr);
+    }
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, acc);
+    done = i;
+    return Min::scalar(lanes[0], lanes[1]);
+}
+
+VEINS_SIMD_TARGET_AVX2 double minSinrAvx2(const double* signal, const double* interference, double noise, size_t n, size_t& done)
+{
+    const __m256d vnoise = _mm256_set1_pd(noise);
+    __m256d acc = _mm256_set1_pd(std::numeric_limits<double>::infinity());
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d sinr = _mm256_div_pd(_mm256_loadu_pd(signal + i), _mm256_add_pd(_mm256_loadu_pd(interference + i), vnoise));
+        acc = Min::avx2(acc, sinr);
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, acc);
+    done = i;
+    return Min::scalar(Min::scalar(lanes[0], lanes[1]), Min::scalar(lanes[2], lanes[3]));
+}
+#endif
+
+} // namespace
+
+void SignalKernels::add(double* dst, const double* src, size_t n)
+{
+    apply<Add>(dst, src, n);
+}
+
+void SignalKernels::subtract(double* dst, const double* src, size_t n)
+{
+    apply<Subtract>(dst, src, n);
+}
+
+void SignalKernels::multiply(double* dst, const double* src, size_t n)
+{
+    apply<Multiply>(dst, src, n);
+}
+
+void SignalKernels::divide(double* dst, const double* src, size_t n)
+{
+    apply<Divide>(dst, src, n);
+}
+
+void SignalKernels::add(double* dst, double value, size_t n)
+{
+    apply<Add>(dst, value, n);
+}
+
+void SignalKernels::subtract(double* dst, double value, size_t n)
+{
+    apply<Subtract>(dst, value, n);
+}
+
+void SignalKernels::multiply(double* dst, double value, size_t n)
+{
+    apply<Multiply>(dst, value, n);
+}
+
+void SignalKernels::divide(double* dst, double value, size_t n)
+{
+    apply<Divide>(dst, value, n);
+}
+
+double SignalKernels::min(const double* values, size_t n)
+{
+    return reduce<Min>(values, n, std::numeric_limits<double>::infinity());
+}
+
+double SignalKernels::max(const double* values, size_t n)
+{
+    return reduce<Max>(values, n, -std::numeric_limits<double>::infinity());
+}
+
+double SignalKernels::minSinr(const double* signal, const double* interference, double noise, size_t n)
+{
+    double result = std::numeric_limits<double>::infinity();
+    size_t done = 0;
+#if VEINS_SIMD_X86
+    switch (simd::getInstructionSet()) {
+    case simd::InstructionSet::avx2:
+        result = minSinrAvx2(signal, interference, noise, n, done);
+        break;
+    case simd::InstructionSet::sse2:
+        result = minSinrSse2(signal, interference, noise, n, done);
+        break;
+    case simd::InstructionSet::scalar:
+        break;
+    }
+#endif
+    for (size_t i = done; i < n; ++i) {
+        result = Min::scalar(result, signal[i] / (interference[i] + noise));
+    }
+    return result;
+}
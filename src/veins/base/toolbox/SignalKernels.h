@@ -0,0 +1,72 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstddef>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief Elementwise arithmetic and reductions over arrays of power values, as used by Signal.
+ *
+ * All functions dispatch to an AVX2 or SSE2 kernel if supported (see simd::getInstructionSet()).
+ * Kernels perform exactly the same floating point operations as the scalar code,
+ * so results are identical regardless of the instruction set used.
+ */
+namespace SignalKernels {
+
+/** @brief Sets dst[i] to dst[i] + src[i] for all i < n. */
+VEINS_API void add(double* dst, const double* src, size_t n);
+/** @brief Sets dst[i] to dst[i] - src[i] for all i < n. */
+VEINS_API void subtract(double* dst, const double* src, size_t n);
+/** @brief Sets dst[i] to dst[i] * src[i] for all i < n. */
+VEINS_API void multiply(double* dst, const double* src, size_t n);
+/** @brief Sets dst[i] to dst[i] / src[i] for all i < n. */
+VEINS_API void divide(double* dst, const double* src, size_t n);
+
+/** @brief Sets dst[i] to dst[i] + value for all i < n. */
+VEINS_API void add(double* dst, double value, size_t n);
+/** @brief Sets dst[i] to dst[i] - value for all i < n. */
+VEINS_API void subtract(double* dst, double value, size_t n);
+/** @brief Sets dst[i] to dst[i] * value for all i < n. */
+VEINS_API void multiply(double* dst, double value, size_t n);
+/** @brief Sets dst[i] to dst[i] / value for all i < n. */
+VEINS_API void divide(double* dst, double value, size_t n);
+
+/** @brief Returns the smallest of n values, or infinity if n is 0. */
+VEINS_API double min(const double* values, size_t n);
+/** @brief Returns the largest of n values, or -infinity if n is 0. */
+VEINS_API double max(const double* values, size_t n);
+
+/**
+ * @brief Returns the smallest signal[i] / (interference[i] + noise) for all i < n, or infinity if n is 0.
+ *
+ * Computes the minimum SINR without materializing the intermediate Signals.
+ */
+VEINS_API double minSinr(const double* signal, const double* interference, double noise, size_t n);
+
+} // namespace SignalKernels
+} // namespace veins
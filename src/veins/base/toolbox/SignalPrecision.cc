@@ -0,0 +1,190 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/toolbox/SignalPrecision.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace veins;
+
+namespace {
+
+const double fixedPointStepsPerDb = 128;
+// the smallest representable value encodes zero power (i.e., -infinity dBm)
+const int16_t fixedPointZero = std::numeric_limits<int16_t>::min();
+
+int16_t encodeFixedPointDb(double value)
+{
+    if (!(value >= 0)) {
+        throw cRuntimeError("Cannot represent power value %f in dBm", value);
+    }
+    if (value == 0) {
+        return fixedPointZero;
+    }
+    double steps = std::round(10 * std::log10(value) * fixedPointStepsPerDb);
+    // saturate instead of wrapping around
+    steps = std::max<double>(steps, fixedPointZero + 1);
+    steps = std::min<double>(steps, std::numeric_limits<int16_t>::max());
+    return static_cast<int16_t>(steps);
+}
+
+double decodeFixedPointDb(int16_t value)
+{
+    if (value == fixedPointZero) {
+        return 0;
+    }
+    return std::pow(10.0, value / fixedPointStepsPerDb / 10);
+}
+
+} // namespace
+
+SignalPrecision veins::parseSignalPrecision(const std::string& name)
+{
+    if (name == "double") return SignalPrecision::Double;
+    if (name == "single") return SignalPrecision::Single;
+    if (name == "fixedPointDb") return SignalPrecision::FixedPointDb;
+    throw cRuntimeError("Unknown signal precision \"%s\" (expected \"double\", \"single\", or \"fixedPointDb\")", name.c_str());
+}
+
+CompactSignalValues::CompactSignalValues(const Signal& signal, SignalPrecision precision)
+    : precision(precision)
+    , count(signal.getNumValues())
+{
+    if (getNumValueBytes() > inlineCapacity) {
+        heapValues.reset(new uint8_t[getNumValueBytes()]);
+    }
+    const double* values = signal.getValues();
+    switch (precision) {
+    case SignalPrecision::Double:
+        std::copy(values, values + count, data<double>());
+        break;
+    case SignalPrecision::Single:
+        std::copy(values, values + count, data<float>());
+        break;
+    case SignalPrecision::FixedPointDb:
+        std::transform(values, values + count, data<int16_t>(), encodeFixedPointDb);
+        break;
+    }
+}
+
+CompactSignalValues::CompactSignalValues(const CompactSignalValues& other)
+    : precision(other.precision)
+    , count(other.count)
+{
+    if (other.heapValues) {
+        heapValues.reset(new uint8_t[getNumValueBytes()]);
+    }
+    std::copy(other.data<uint8_t>(), other.data<uint8_t>() + getNumValueBytes(), data<uint8_t>());
+}
+
+CompactSignalValues& CompactSignalValues::operator=(CompactSignalValues other)
+{
+    precision = other.precision;
+    count = other.count;
+    std::copy(other.inlineValues, other.inlineValues + inlineCapacity, inlineValues);
+    heapValues = std::move(other.heapValues);
+    return *this;
+}
+
+size_t CompactSignalValues::getNumValueBytes() const
+{
+    switch (precision) {
+    case SignalPrecision::Single:
+        return count * sizeof(float);
+    case SignalPrecision::FixedPointDb:
+        return count * sizeof(int16_t);
+    default:
+        return count * sizeof(double);
+    }
+}
+
+size_t CompactSignalValues::getNumBytes() const
+{
+    return sizeof(*this) + (heapValues ? getNumValueBytes() : 0);
+}
+
+void CompactSignalValues::decodeInto(Signal& signal) const
+{
+    if (signal.getNumValues() != size()) {
+        throw cRuntimeError("Cannot decode %zu power values into a Signal with %zu values", size(), signal.getNumValues());
+    }
+    if (size() == 0) {
+        return;
+    }
+    double* values = signal.getValues();
+    switch (precision) {
+    case SignalPrecision::Double:
+        std::copy(data<double>(), data<double>() + count, values);
+        break;
+    case SignalPrecision::Single:
+        std::copy(data<float>(), data<float>() + count, values);
+        break;
+    case SignalPrecision::FixedPointDb:
+        std::transform(data<int16_t>(), data<int16_t>() + count, values, decodeFixedPointDb);
+        break;
+    }
+}
+
+void CompactSignalValues::multiplyInto(Signal& signal) const
+{
+    if (signal.getNumValues() != size()) {
+        throw cRuntimeError("Cannot multiply %zu power values into a Signal with %zu values", size(), signal.getNumValues());
+    }
+    if (size() == 0) {
+        return;
+    }
+    double* values = signal.getValues();
+    switch (precision) {
+    case SignalPrecision::Double: {
+        const double* factors = data<double>();
+        for (size_t i = 0; i < count; ++i) {
+            values[i] *= factors[i];
+        }
+        break;
+    }
+    case SignalPrecision::Single: {
+        const float* factors = data<float>();
+        for (size_t i = 0; i < count; ++i) {
+            values[i] *= factors[i];
+        }
+        break;
+    }
+    case SignalPrecision::FixedPointDb: {
+        const int16_t* factors = data<int16_t>();
+        for (size_t i = 0; i < count; ++i) {
+            values[i] *= decodeFixedPointDb(factors[i]);
+        }
+        break;
+    }
+    }
+}
+
+void veins::quantize(Signal& signal, SignalPrecision precision)
+{
+    if (precision == SignalPrecision::Double) {
+        return;
+    }
+    CompactSignalValues(signal, precision).decodeInto(signal);
+}
@@ -0,0 +1,147 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "veins/veins.h"
+
+#include "veins/base/toolbox/Signal.h"
+
+namespace veins {
+
+/**
+ * @brief Representations the power values of a Signal can be stored in.
+ */
+enum class SignalPrecision {
+    Double, ///< 64 bit floating point in milliwatt, as used by Signal itself (lossless)
+    Single, ///< 32 bit floating point in milliwatt
+    FixedPointDb, ///< 16 bit fixed point in dBm with a resolution of 1/128 dB, covering -256 dBm to +256 dBm
+};
+
+/**
+ * @brief Returns the SignalPrecision of the given name ("double", "single", or "fixedPointDb").
+ */
+VEINS_API SignalPrecision parseSignalPrecision(const std::string& name);
+
+/**
+ * @brief The power values of a Signal, encoded in a compact SignalPrecision.
+ *
+ * Signals themselves always compute in (and hand out references to) 64 bit floating point values.
+ * Converting to and from this class at the API boundary allows storing power values in less memory,
+ * at the cost of the precision lost when encoding them.
+ *
+ * Encoded values are kept in a single buffer, which is stored inline if it fits into inlineCapacity bytes
+ * (e.g., the few values of a narrowband Signal) and allocated on the heap otherwise.
+ * Thus, only Signals larger than that take up less memory in a more compact SignalPrecision.
+ *
+ * @note The FixedPointDb representation can only hold non-negative power values.
+ */
+class VEINS_API CompactSignalValues {
+public:
+    /**
+     * Number of bytes of encoded values stored without a heap allocation.
+     */
+    static constexpr size_t inlineCapacity = 32;
+
+    CompactSignalValues() = default;
+
+    /**
+     * Encode the power values of the given Signal.
+     */
+    CompactSignalValues(const Signal& signal, SignalPrecision precision);
+
+    CompactSignalValues(const CompactSignalValues& other);
+    CompactSignalValues(CompactSignalValues&& other) = default;
+    CompactSignalValues& operator=(CompactSignalValues other);
+
+    SignalPrecision getPrecision() const
+    {
+        return precision;
+    }
+
+    /**
+     * Returns the number of encoded power values.
+     */
+    size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * Returns the number of bytes occupied by this object, including the encoded power values on the heap (if any).
+     */
+    size_t getNumBytes() const;
+
+    /**
+     * Overwrite the power values of the given Signal with the decoded ones.
+     *
+     * The Signal must hold as many values as were encoded.
+     */
+    void decodeInto(Signal& signal) const;
+
+    /**
+     * Multiply the power values of the given Signal by the decoded ones, e.g., to apply a stored attenuation.
+     *
+     * The Signal must hold as many values as were encoded.
+     */
+    void multiplyInto(Signal& signal) const;
+
+private:
+    /**
+     * Returns the number of bytes taken up by the encoded values.
+     */
+    size_t getNumValueBytes() const;
+
+    /**
+     * Returns the encoded values, interpreted as the type used by the current SignalPrecision.
+     */
+    template <typename T>
+    T* data()
+    {
+        return reinterpret_cast<T*>(heapValues ? heapValues.get() : inlineValues);
+    }
+
+    template <typename T>
+    const T* data() const
+    {
+        return reinterpret_cast<const T*>(heapValues ? heapValues.get() : inlineValues);
+    }
+
+    SignalPrecision precision = SignalPrecision::Double;
+    uint32_t count = 0;
+    alignas(double) uint8_t inlineValues[inlineCapacity];
+    std::unique_ptr<uint8_t[]> heapValues;
+};
+
+/**
+ * @brief Round the power values of the given Signal to those representable in the given SignalPrecision.
+ *
+ * Yields the same power values as encoding the Signal as CompactSignalValues and decoding it again.
+ */
+VEINS_API void quantize(Signal& signal, SignalPrecision precision);
+
+} // namespace veins
@@ -23,6 +23,7 @@
 #include "veins/base/toolbox/SignalUtils.h"
 
 #include "veins/base/messages/AirFrame_m.h"
+#include "veins/base/toolbox/SignalKernels.h"
 
 #include <queue>
 
@@ -33,18 +34,19 @@ namespace {
 
 template <typename T>
 struct greaterByReceptionEnd {
-    bool operator()(const T& lhs, const T& rhs) const
+    bool operator()(const T* lhs, const T* rhs) const
     {
-        return lhs.getReceptionEnd() > rhs.getReceptionEnd();
+        return lhs->getReceptionEnd() > rhs->getReceptionEnd();
     };
 };
 
 Signal getMaxInterference(simtime_t start, simtime_t end, AirFrame* const referenceFrame, AirFrameVector& interfererFrames)
 {
-    Spectrum spectrum = referenceFrame->getSignal().getSpectrum();
+    const Spectrum& spectrum = referenceFrame->getSignal().getSpectrum();
     Signal maxInterference(spectrum);
     Signal currentInterference(spectrum);
-    std::priority_queue<Signal, std::vector<Signal>, greaterByReceptionEnd<Signal>> signalEndings;
+    // interferers outlive this function, so there is no need to copy their Signals
+    std::priority_queue<const Signal*, std::vector<const Signal*>, greaterByReceptionEnd<Signal>> signalEndings;
     simtime_t currentTime = 0;
 
     interfererFrames.sort([](const AirFrame* x, const AirFrame* y) { return x->getConstSignal().getReceptionStart() < y->getConstSignal().getReceptionStart(); });
@@ -58,15 +60,15 @@ Signal getMaxInterference(simtime_t start, simtime_t end, AirFrame* const refere
         ASSERT(signal.getReceptionStart() >= currentTime); // assume frames are sorted by reception start time
         ASSERT(signal.getSpectrum() == spectrum);
         // fetch next signal and advance current time to its start
-        signalEndings.push(signal);
+        signalEndings.push(&signal);
         currentTime = signal.getReceptionStart();
 
         // abort at end time
         if (currentTime >= end) break;
 
         // remove signals ending before the start of the current one
-        while (signalEndings.top().getReceptionEnd() <= currentTime) {
-            currentInterference -= signalEndings.top();
+        while (signalEndings.top()->getReceptionEnd() <= currentTime) {
+            currentInterference -= *signalEndings.top();
             signalEndings.pop();
         }
 
@@ -121,9 +123,7 @@ bool VEINS_API isChannelPowerBelowThreshold(simtime_t now, AirFrameVector& inter
         ASSERT(analogueModelCount == signalPtr->getAnalogueModelList()->size());
     }
     for (size_t analogueModelIndex = 0; analogueModelIndex < analogueModelCount; ++analogueModelIndex) {
-        for (auto signalPtr : interferers) {
-            signalPtr->applyAnalogueModel(analogueModelIndex);
-        }
+        Signal::applyAnalogueModel(interferers, analogueModelIndex);
         if (powerLevelSumAtFrequencyIndex(interferers, freqIndex) < threshold) {
             return true;
         }
@@ -140,22 +140,19 @@ double VEINS_API getMinSINR(simtime_t start, simtime_t end, AirFrame* signalFram
     ASSERT(end <= signalFrame->getSignal().getReceptionEnd());
 
     // Make sure all filters are applied
-    signalFrame->getSignal().applyAllAnalogueModels();
+    std::vector<Signal*> signals = {&signalFrame->getSignal()};
     for (auto& interfererFrame : interfererFrames) {
-        interfererFrame->getSignal().applyAllAnalogueModels();
+        signals.push_back(&interfererFrame->getSignal());
     }
+    Signal::applyAllAnalogueModels(signals);
 
     Signal& signal = signalFrame->getSignal();
-    Spectrum spectrum = signal.getSpectrum();
 
     Signal interference = getMaxInterference(start, end, signalFrame, interfererFrames);
-    Signal sinr = signal / (interference + noise);
 
-    double min_sinr = INFINITY;
-    for (uint16_t i = signal.getDataStart(); i < signal.getDataEnd(); i++) {
-        min_sinr = std::min(min_sinr, sinr.at(i));
-    }
-    return min_sinr;
+    // compute min(signal / (interference + noise)) over all data channels without intermediate Signals
+    const Signal& constSignal = signal;
+    return SignalKernels::minSinr(constSignal.getDataValues(), interference.getValues() + signal.getDataStart(), noise, signal.getNumDataValues());
 }
 
 } // namespace SignalUtils
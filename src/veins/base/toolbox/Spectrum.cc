@@ -34,47 +34,94 @@ Spectrum::Frequencies normalizeFrequencies(Spectrum::Frequencies freqs)
     return freqs;
 }
 
+Spectrum::Spectrum()
+    : grid(emptyGrid())
+{
+}
+
 Spectrum::Spectrum(Spectrum::Frequencies freqs)
-    : frequencies(normalizeFrequencies(freqs))
+    : grid(intern(normalizeFrequencies(std::move(freqs))))
+{
+}
+
+std::shared_ptr<const Spectrum::Grid> Spectrum::emptyGrid()
 {
+    // default-constructed Signals are common, so they skip the registry lookup
+    static const std::shared_ptr<const Grid> grid = std::make_shared<const Grid>();
+    return grid;
+}
+
+std::shared_ptr<const Spectrum::Grid> Spectrum::intern(Frequencies freqs)
+{
+    if (freqs.empty()) {
+        return emptyGrid();
+    }
+
+    // grids are only kept alive by the Spectrum objects using them
+    static std::map<Frequencies, std::weak_ptr<const Grid>> registry;
+
+    auto& entry = registry[freqs];
+    if (auto existing = entry.lock()) {
+        return existing;
+    }
+
+    // drop grids that are no longer used by any Spectrum
+    for (auto it = registry.begin(); it != registry.end();) {
+        if (it->second.expired() && &it->second != &entry) {
+            it = registry.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+
+    auto grid = std::make_shared<Grid>();
+    grid->frequencies = std::move(freqs);
+    for (size_t i = 0; i < grid->frequencies.size(); i++) {
+        grid->indices[grid->frequencies[i]] = i;
+    }
+    entry = grid;
+    return grid;
 }
 
 const double& Spectrum::operator[](size_t index) const
 {
-    return frequencies.at(index);
+    return grid->frequencies.at(index);
 }
 
 size_t Spectrum::indexOf(double freq) const
 {
-    // Binary search
-    auto it = std::lower_bound(frequencies.begin(), frequencies.end(), freq);
-    bool found = it != frequencies.end() && (*it) == freq;
+    auto it = grid->indices.find(freq);
+
+    bool found = it != grid->indices.end();
 
     ASSERT(found == true);
 
-    return std::distance(frequencies.begin(), it);
+    // an unknown frequency maps past the end, so accessing values there fails
+    return found ? it->second : getNumFreqs();
 }
 
 double Spectrum::freqAt(size_t freqIndex) const
 {
-    return frequencies.at(freqIndex);
+    return grid->frequencies.at(freqIndex);
 }
 
 size_t Spectrum::getNumFreqs() const
 {
-    return frequencies.size();
+    return grid->frequencies.size();
 }
 
 bool operator==(const Spectrum& lhs, const Spectrum& rhs)
 {
-    return lhs.frequencies == rhs.frequencies;
+    // grids are interned, so equal frequencies imply the same grid
+    return lhs.grid == rhs.grid;
 }
 
 std::ostream& operator<<(std::ostream& os, const Spectrum& s)
 {
     os << "Spectrum(";
     std::ostringstream ss;
-    for (auto&& frequency : s.frequencies) {
+    for (auto&& frequency : s.grid->frequencies) {
         if (ss.tellp() != 0) {
             ss << ", ";
         }
@@ -30,17 +30,24 @@
 #include <memory>
 #include <fstream>
 #include <map>
+#include <unordered_map>
 
 #include "veins/veins.h"
 
 namespace veins {
 
+/**
+ * The set of frequencies a Signal is defined on, sorted in ascending order.
+ *
+ * A Spectrum is immutable and interned: all Spectrum objects defined on the same frequencies share one grid,
+ * so copying a Spectrum is cheap and comparing two of them only compares pointers.
+ */
 class VEINS_API Spectrum {
 public:
     using Frequency = double;
     using Frequencies = std::vector<Frequency>;
 
-    Spectrum() = default;
+    Spectrum();
     Spectrum(Frequencies freqs);
 
     const double& operator[](size_t index) const;
@@ -56,7 +63,25 @@ public:
     friend std::ostream& VEINS_API operator<<(std::ostream& os, const Spectrum& s);
 
 private:
-    Frequencies frequencies;
+    /**
+     * A distinct set of frequencies, along with a lookup table from frequency to index.
+     */
+    struct Grid {
+        Frequencies frequencies;
+        std::unordered_map<Frequency, size_t> indices;
+    };
+
+    /**
+     * Return the Grid for the passed (normalized) frequencies, creating it if no Spectrum currently uses them.
+     */
+    static std::shared_ptr<const Grid> intern(Frequencies freqs);
+
+    /**
+     * Return the Grid without any frequencies, which is never unused and thus kept outside the registry.
+     */
+    static std::shared_ptr<const Grid> emptyGrid();
+
+    std::shared_ptr<const Grid> grid;
 };
 
 } // namespace veins
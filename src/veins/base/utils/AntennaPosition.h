@@ -66,6 +66,14 @@ public:
         return p + v * dt.dbl();
     }
 
+    /**
+     * Get the identifier of the antenna, as returned by ChannelAccess::getId().
+     */
+    int getId() const
+    {
+        return id;
+    }
+
     bool isSameAntenna(const AntennaPosition& o) const
     {
         ASSERT(!undef);
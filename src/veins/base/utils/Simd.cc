@@ -0,0 +1,59 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/base/utils/Simd.h"
+
+#include <algorithm>
+
+namespace veins {
+namespace simd {
+
+namespace {
+
+InstructionSet detectInstructionSet()
+{
+#if VEINS_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return InstructionSet::avx2;
+    if (__builtin_cpu_supports("sse2")) return InstructionSet::sse2;
+#endif
+    return InstructionSet::scalar;
+}
+
+const InstructionSet supportedInstructionSet = detectInstructionSet();
+InstructionSet activeInstructionSet = supportedInstructionSet;
+
+} // namespace
+
+InstructionSet getInstructionSet()
+{
+    return activeInstructionSet;
+}
+
+void setInstructionSet(InstructionSet instructionSet)
+{
+    activeInstructionSet = std::min(instructionSet, supportedInstructionSet);
+}
+
+} // namespace simd
+} // namespace veins
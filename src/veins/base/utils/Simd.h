@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include "veins/veins.h"
+
+/**
+ * @file Simd.h
+ * @brief Support for kernels that make use of SIMD instructions if the CPU running the simulation supports them.
+ *
+ * Kernels are compiled for a specific instruction set using VEINS_SIMD_TARGET_AVX2 (or VEINS_SIMD_TARGET_SSE2)
+ * and are selected at runtime. Every kernel needs a portable scalar implementation that is used if
+ * VEINS_SIMD_X86 is not set or the instruction set is not available.
+ */
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(VEINS_NO_SIMD)
+#define VEINS_SIMD_X86 1
+#define VEINS_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define VEINS_SIMD_TARGET_SSE2 __attribute__((target("sse2")))
+#else
+#define VEINS_SIMD_X86 0
+#endif
+
+namespace veins {
+namespace simd {
+
+/**
+ * Instruction sets a kernel can be dispatched to.
+ */
+enum class InstructionSet {
+    scalar,
+    sse2,
+    avx2
+};
+
+/**
+ * Returns the best instruction set supported by the CPU running the simulation (or the one set by setInstructionSet()).
+ */
+VEINS_API InstructionSet getInstructionSet();
+
+/**
+ * Restricts kernels to the given instruction set (if it is supported), e.g. to compare results against the scalar implementation.
+ */
+VEINS_API void setInstructionSet(InstructionSet instructionSet);
+
+} // namespace simd
+} // namespace veins
@@ -93,6 +93,11 @@ public:
      */
     void filterSignal(Signal*) override;
 
+    bool dependsOnlyOnGeometry() const override
+    {
+        return true;
+    }
+
     virtual bool isActiveAtDestination()
     {
         return true;
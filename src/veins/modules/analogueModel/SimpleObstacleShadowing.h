@@ -78,6 +78,11 @@ public:
     {
         return true;
     }
+
+    bool dependsOnlyOnGeometry() const override
+    {
+        return true;
+    }
 };
 
 } // namespace veins
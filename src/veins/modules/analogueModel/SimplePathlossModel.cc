@@ -32,27 +32,56 @@ using veins::AirFrame;
 
 void SimplePathlossModel::filterSignal(Signal* signal)
 {
-    auto senderPos = signal->getSenderPoa().pos.getPositionAt();
-    auto receiverPos = signal->getReceiverPoa().pos.getPositionAt();
+    filterSignals({signal});
+}
 
-    /** Calculate the distance factor */
-    double sqrDistance = useTorus ? receiverPos.sqrTorusDist(senderPos, playgroundSize) : receiverPos.sqrdist(senderPos);
+void SimplePathlossModel::filterSignals(const std::vector<Signal*>& signals)
+{
+    // the part of the attenuation only depending on the frequency, shared by all signals on the same spectrum
+    Spectrum spectrum;
+    std::vector<double> sqrWavelengths;
 
-    EV_TRACE << "sqrdistance is: " << sqrDistance << endl;
+    for (auto signal : signals) {
+        auto senderPos = signal->getSenderPoa().pos.getPositionAt();
+        auto receiverPos = signal->getReceiverPoa().pos.getPositionAt();
 
-    if (sqrDistance <= 1.0) {
-        // attenuation is negligible
-        return;
-    }
+        /** Calculate the distance factor */
+        double sqrDistance = useTorus ? receiverPos.sqrTorusDist(senderPos, playgroundSize) : receiverPos.sqrdist(senderPos);
+
+        EV_TRACE << "sqrdistance is: " << sqrDistance << endl;
+
+        if (sqrDistance <= 1.0) {
+            // attenuation is negligible
+            continue;
+        }
 
-    // the part of the attenuation only depending on the distance
-    double distFactor = pow(sqrDistance, -pathLossAlphaHalf) / (16.0 * M_PI * M_PI);
-    EV_TRACE << "distance factor is: " << distFactor << endl;
+        // the part of the attenuation only depending on the distance
+        double distFactor = pow(sqrDistance, -pathLossAlphaHalf) / (16.0 * M_PI * M_PI);
+        EV_TRACE << "distance factor is: " << distFactor << endl;
 
-    Signal attenuation(signal->getSpectrum());
-    for (uint16_t i = 0; i < signal->getNumValues(); i++) {
-        double wavelength = BaseWorldUtility::speedOfLight() / signal->getSpectrum().freqAt(i);
-        attenuation.at(i) = (wavelength * wavelength) * distFactor;
+        if (!(signal->getSpectrum() == spectrum)) {
+            spectrum = signal->getSpectrum();
+            sqrWavelengths.resize(spectrum.getNumFreqs());
+            for (size_t i = 0; i < sqrWavelengths.size(); i++) {
+                double wavelength = BaseWorldUtility::speedOfLight() / spectrum.freqAt(i);
+                sqrWavelengths[i] = wavelength * wavelength;
+            }
+        }
+
+        Signal attenuation(signal->getSpectrum());
+        for (uint16_t i = 0; i < signal->getNumValues(); i++) {
+            attenuation.at(i) = sqrWavelengths[i] * distFactor;
+        }
+        *signal *= attenuation;
     }
-    *signal *= attenuation;
+}
+
+double SimplePathlossModel::getDistanceForAttenuation(double attenuation, double frequency)
+{
+    // invert the attenuation wavelength^2 / (16 pi^2 d^alpha), which grows with the wavelength
+    double wavelength = BaseWorldUtility::speedOfLight() / frequency;
+    double distance = pow((wavelength * wavelength) / (16.0 * M_PI * M_PI * attenuation), 0.5 / pathLossAlphaHalf);
+
+    // up to 1m, signals are not attenuated at all
+    return std::max(distance, 1.0);
 }
@@ -91,10 +91,22 @@ public:
      */
     void filterSignal(Signal*) override;
 
+    /**
+     * @brief Filters several Signals, computing the frequency dependent part of the attenuation only once per Spectrum.
+     */
+    void filterSignals(const std::vector<Signal*>& signals) override;
+
     bool neverIncreasesPower() override
     {
         return true;
     }
+
+    bool dependsOnlyOnGeometry() const override
+    {
+        return true;
+    }
+
+    double getDistanceForAttenuation(double attenuation, double frequency) override;
 };
 
 } // namespace veins
@@ -64,6 +64,8 @@ void Mac1609_4::initialize(int stage)
         useAcks = par("useAcks").boolValue();
         frameErrorRate = par("frameErrorRate").doubleValue();
         ackErrorRate = par("ackErrorRate").doubleValue();
+        duplicateDetectionTimeout = par("duplicateDetectionTimeout").doubleValue();
+        lastDuplicateDetectionSweep = simTime();
         rxStartIndication = false;
         ignoreChannelState = false;
         waitUntilAckRXorTimeout = false;
@@ -637,12 +639,19 @@ int Mac1609_4::EDCA::queuePacket(t_access_category ac, BaseFrame1609_4* msg)
 void Mac1609_4::EDCA::createQueue(int aifsn, int cwMin, int cwMax, t_access_category ac)
 {
 
-    if (myQueues.find(ac) != myQueues.end()) {
+    EDCAQueue& edcaQueue = myQueues[ac];
+    if (edcaQueue.ackTimeOut) {
         throw cRuntimeError("You can only add one queue per Access Category per EDCA subsystem");
     }
 
-    EDCAQueue newQueue(aifsn, cwMin, cwMax, ac);
-    myQueues[ac] = newQueue;
+    edcaQueue.aifsn = aifsn;
+    edcaQueue.cwMin = cwMin;
+    edcaQueue.cwMax = cwMax;
+    edcaQueue.cwCur = cwMin;
+    edcaQueue.ackTimeOut = new AckTimeOutMessage("AckTimeOut");
+    edcaQueue.ackTimeOut->setKind(ac);
+    // allocate all frame slots up front so queueing never allocates while the MAC is running
+    edcaQueue.queue.reserve(maxQueueSize);
 }
 
 Mac1609_4::t_access_category Mac1609_4::mapUserPriority(int prio)
@@ -685,24 +694,25 @@ BaseFrame1609_4* Mac1609_4::EDCA::initiateTransmit(simtime_t lastIdle)
     // As t_access_category is sorted by priority, we iterate back to front.
     // This realizes the behavior documented in IEEE Std 802.11-2012 Section 9.2.4.2; that is, "data frames from the higher priority AC" win an internal collision.
     // The phrase "EDCAF of higher UP" of IEEE Std 802.11-2012 Section 9.19.2.3 is assumed to be meaningless.
-    for (auto iter = myQueues.rbegin(); iter != myQueues.rend(); iter++) {
-        if (iter->second.queue.size() != 0 && !iter->second.waitForAck) {
-            if (idleTime >= iter->second.aifsn * SLOTLENGTH_11P + SIFS_11P && iter->second.txOP == true) {
+    for (int accessCategory = AC_VO; accessCategory >= AC_BK; accessCategory--) {
+        auto& edcaQueue = myQueues[accessCategory];
+        if (!edcaQueue.queue.empty() && !edcaQueue.waitForAck) {
+            if (idleTime >= edcaQueue.aifsn * SLOTLENGTH_11P + SIFS_11P && edcaQueue.txOP == true) {
 
-                EV_TRACE << "Queue " << iter->first << " is ready to send!" << std::endl;
+                EV_TRACE << "Queue " << accessCategory << " is ready to send!" << std::endl;
 
-                iter->second.txOP = false;
+                edcaQueue.txOP = false;
                 // this queue is ready to send
                 if (pktToSend == nullptr) {
-                    pktToSend = iter->second.queue.front();
+                    pktToSend = edcaQueue.queue.front();
                 }
                 else {
                     // there was already another packet ready. we have to go increase cw and go into backoff. It's called internal contention and its wonderful
 
                     statsNumInternalContention++;
-                    iter->second.cwCur = std::min(iter->second.cwMax, (iter->second.cwCur + 1) * 2 - 1);
-                    iter->second.currentBackoff = owner->intuniform(0, iter->second.cwCur);
-                    EV_TRACE << "Internal contention for queue " << iter->first << " : " << iter->second.currentBackoff << ". Increase cwCur to " << iter->second.cwCur << std::endl;
+                    edcaQueue.cwCur = std::min(edcaQueue.cwMax, (edcaQueue.cwCur + 1) * 2 - 1);
+                    edcaQueue.currentBackoff = owner->intuniform(0, edcaQueue.cwCur);
+                    EV_TRACE << "Internal contention for queue " << accessCategory << " : " << edcaQueue.currentBackoff << ". Increase cwCur to " << edcaQueue.cwCur << std::endl;
                 }
             }
         }
@@ -730,10 +740,9 @@ simtime_t Mac1609_4::EDCA::startContent(simtime_t idleSince, bool guardActive)
 
     // this returns the nearest possible event in this EDCA subsystem after a busy channel
 
-    for (auto&& p : myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
-        if (edcaQueue.queue.size() != 0 && !edcaQueue.waitForAck) {
+    for (int accessCategory = AC_BK; accessCategory <= AC_VO; accessCategory++) {
+        auto& edcaQueue = myQueues[accessCategory];
+        if (!edcaQueue.queue.empty() && !edcaQueue.waitForAck) {
 
             /* 1609_4 says that when attempting to send (backoff == 0) when guard is active, a random backoff is invoked */
 
@@ -779,10 +788,9 @@ void Mac1609_4::EDCA::stopContent(bool allowBackoff, bool generateTxOp)
 
     lastStart = -1; // indicate that there was no last start
 
-    for (auto&& p : myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
-        if ((edcaQueue.currentBackoff != 0 || edcaQueue.queue.size() != 0) && !edcaQueue.waitForAck) {
+    for (int accessCategory = AC_BK; accessCategory <= AC_VO; accessCategory++) {
+        auto& edcaQueue = myQueues[accessCategory];
+        if ((edcaQueue.currentBackoff != 0 || !edcaQueue.queue.empty()) && !edcaQueue.waitForAck) {
             // check how many slots we already waited until the chan became busy
 
             int64_t oldBackoff = edcaQueue.currentBackoff;
@@ -801,7 +809,7 @@ void Mac1609_4::EDCA::stopContent(bool allowBackoff, bool generateTxOp)
 
                 EV_TRACE << "Passed slots after DIFS: " << passedSlots << std::endl;
 
-                if (edcaQueue.queue.size() == 0) {
+                if (edcaQueue.queue.empty()) {
                     // this can be below 0 because of post transmit backoff -> backoff on empty queues will not generate macevents,
                     // we dont want to generate a txOP for empty queues
                     edcaQueue.currentBackoff -= std::min(edcaQueue.currentBackoff, passedSlots);
@@ -868,7 +876,7 @@ Mac1609_4::EDCA::EDCA(cSimpleModule* owner, ChannelType channelType, int maxQueu
 Mac1609_4::EDCA::~EDCA()
 {
     for (auto& q : myQueues) {
-        auto& ackTimeout = q.second.ackTimeOut;
+        auto& ackTimeout = q.ackTimeOut;
         if (ackTimeout) {
             owner->cancelAndDelete(ackTimeout);
             ackTimeout = nullptr;
@@ -878,8 +886,7 @@ Mac1609_4::EDCA::~EDCA()
 
 void Mac1609_4::EDCA::revokeTxOPs()
 {
-    for (auto&& p : myQueues) {
-        auto& edcaQueue = p.second;
+    for (auto& edcaQueue : myQueues) {
         if (edcaQueue.txOP == true) {
             edcaQueue.txOP = false;
             edcaQueue.currentBackoff = 0;
@@ -1041,8 +1048,32 @@ void Mac1609_4::handleUnicast(LAddress::L2Type srcAddr, unique_ptr<BaseFrame1609
         sendAck(srcAddr, wsm->getTreeId());
     }
 
-    if (handledUnicastToApp.find(wsm->getTreeId()) == handledUnicastToApp.end()) {
-        handledUnicastToApp.insert(wsm->getTreeId());
+    // forget senders that can no longer be retransmitting, at most once per timeout
+    if (simTime() - lastDuplicateDetectionSweep >= duplicateDetectionTimeout) {
+        lastDuplicateDetectionSweep = simTime();
+        for (auto it = lastUnicastToApp.begin(); it != lastUnicastToApp.end();) {
+            if (simTime() - it->second.lastReceived >= duplicateDetectionTimeout) {
+                it = lastUnicastToApp.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+    }
+
+    auto inserted = lastUnicastToApp.emplace(srcAddr, LastUnicastsToApp());
+    LastUnicastsToApp& lastUnicasts = inserted.first->second;
+    if (inserted.second) {
+        lastUnicasts.treeIds.fill(-1);
+    }
+    lastUnicasts.lastReceived = simTime();
+
+    // the sender queued the frame in the EDCA subsystem of the channel it addressed it to
+    ChannelType chan = (static_cast<Channel>(wsm->getChannelNumber()) == Channel::cch) ? ChannelType::control : ChannelType::service;
+    long& lastTreeId = lastUnicasts.treeIds[static_cast<int>(chan) * 4 + mapUserPriority(wsm->getUserPriority())];
+
+    if (lastTreeId != wsm->getTreeId()) {
+        lastTreeId = wsm->getTreeId();
         EV_TRACE << "Received a data packet addressed to me." << std::endl;
         statsReceivedPackets++;
         sendUp(wsm.release());
@@ -1057,21 +1088,20 @@ void Mac1609_4::handleAck(const Mac80211Ack* ack)
 
     ChannelType chan = ChannelType::control;
     bool queueUnblocked = false;
-    for (auto&& p : myEDCA[chan]->myQueues) {
-        auto& accessCategory = p.first;
-        auto& edcaQueue = p.second;
-        if (edcaQueue.queue.size() > 0 && edcaQueue.waitForAck && (edcaQueue.waitOnUnicastID == ack->getMessageId())) {
+    for (int accessCategory = AC_BK; accessCategory <= AC_VO; accessCategory++) {
+        auto& edcaQueue = myEDCA[chan]->myQueues[accessCategory];
+        if (!edcaQueue.queue.empty() && edcaQueue.waitForAck && (edcaQueue.waitOnUnicastID == ack->getMessageId())) {
             BaseFrame1609_4* wsm = edcaQueue.queue.front();
             edcaQueue.queue.pop();
             delete wsm;
-            myEDCA[chan]->myQueues[accessCategory].cwCur = myEDCA[chan]->myQueues[accessCategory].cwMin;
-            myEDCA[chan]->backoff(accessCategory);
+            edcaQueue.cwCur = edcaQueue.cwMin;
+            myEDCA[chan]->backoff(static_cast<t_access_category>(accessCategory));
             edcaQueue.ssrc = 0;
             edcaQueue.slrc = 0;
             edcaQueue.waitForAck = false;
             edcaQueue.waitOnUnicastID = -1;
-            if (myEDCA[chan]->myQueues[accessCategory].ackTimeOut->isScheduled()) {
-                cancelEvent(myEDCA[chan]->myQueues[accessCategory].ackTimeOut);
+            if (edcaQueue.ackTimeOut->isScheduled()) {
+                cancelEvent(edcaQueue.ackTimeOut);
             }
             queueUnblocked = true;
         }
@@ -1170,27 +1200,41 @@ void Mac1609_4::handleRetransmit(t_access_category ac)
     }
 }
 
-Mac1609_4::EDCA::EDCAQueue::EDCAQueue(int aifsn, int cwMin, int cwMax, t_access_category ac)
-    : aifsn(aifsn)
-    , cwMin(cwMin)
-    , cwMax(cwMax)
-    , cwCur(cwMin)
-    , currentBackoff(0)
-    , txOP(false)
-    , ssrc(0)
-    , slrc(0)
-    , waitForAck(false)
-    , waitOnUnicastID(-1)
-    , ackTimeOut(new AckTimeOutMessage("AckTimeOut"))
+Mac1609_4::EDCA::FrameQueue::~FrameQueue()
 {
-    ackTimeOut->setKind(ac);
+    while (!empty()) {
+        delete front();
+        pop();
+    }
 }
 
-Mac1609_4::EDCA::EDCAQueue::~EDCAQueue()
+void Mac1609_4::EDCA::FrameQueue::reserve(size_t capacity)
 {
-    while (!queue.empty()) {
-        delete queue.front();
-        queue.pop();
+    if (capacity <= slots.size()) return;
+
+    // unwrap the ring into the new slots so that the oldest frame ends up at index 0
+    std::vector<BaseFrame1609_4*> newSlots(capacity, nullptr);
+    for (size_t i = 0; i < count; i++) {
+        newSlots[i] = slots[(head + i) % slots.size()];
     }
-    // ackTimeOut needs to be deleted in EDCA
+    slots.swap(newSlots);
+    head = 0;
+}
+
+void Mac1609_4::EDCA::FrameQueue::push(BaseFrame1609_4* frame)
+{
+    if (count == slots.size()) {
+        // only reached for unlimited queues (or ones without preallocated slots)
+        reserve(std::max<size_t>(8, 2 * slots.size()));
+    }
+    slots[(head + count) % slots.size()] = frame;
+    count++;
+}
+
+void Mac1609_4::EDCA::FrameQueue::pop()
+{
+    ASSERT(count > 0);
+    slots[head] = nullptr;
+    head = (head + 1) % slots.size();
+    count--;
 }
@@ -22,9 +22,11 @@
 
 #pragma once
 
-#include <queue>
+#include <array>
+#include <vector>
 #include <memory>
 #include <stdint.h>
+#include <unordered_map>
 
 #include "veins/veins.h"
 
@@ -89,9 +91,51 @@ public:
 
     class VEINS_API EDCA : HasLogProxy {
     public:
+        /**
+         * @brief FIFO of frames waiting for transmission, kept in a ring of preallocated slots.
+         *
+         * A capacity of 0 means unlimited: the ring then doubles its slots whenever it runs full.
+         * Frames still queued on destruction are deleted.
+         */
+        class VEINS_API FrameQueue {
+        public:
+            FrameQueue()
+                : head(0)
+                , count(0)
+            {
+            }
+            FrameQueue(const FrameQueue&) = delete;
+            FrameQueue& operator=(const FrameQueue&) = delete;
+            ~FrameQueue();
+
+            /** @brief preallocate slots for the given number of frames */
+            void reserve(size_t capacity);
+            void push(BaseFrame1609_4* frame);
+            void pop();
+
+            BaseFrame1609_4* front() const
+            {
+                ASSERT(count > 0);
+                return slots[head];
+            }
+            size_t size() const
+            {
+                return count;
+            }
+            bool empty() const
+            {
+                return count == 0;
+            }
+
+        private:
+            std::vector<BaseFrame1609_4*> slots;
+            size_t head; // index of the oldest frame in slots
+            size_t count; // number of frames currently queued
+        };
+
         class VEINS_API EDCAQueue {
         public:
-            std::queue<BaseFrame1609_4*> queue;
+            FrameQueue queue;
             int aifsn; // number of aifs slots for this queue
             int cwMin; // minimum contention window
             int cwMax; // maximum contention size
@@ -105,10 +149,19 @@ public:
             AckTimeOutMessage* ackTimeOut; // timer for retransmission on receiving no ACK
 
             EDCAQueue()
+                : aifsn(0)
+                , cwMin(0)
+                , cwMax(0)
+                , cwCur(0)
+                , currentBackoff(0)
+                , txOP(false)
+                , ssrc(0)
+                , slrc(0)
+                , waitForAck(false)
+                , waitOnUnicastID(-1)
+                , ackTimeOut(nullptr)
             {
             }
-            EDCAQueue(int aifsn, int cwMin, int cwMax, t_access_category ac);
-            ~EDCAQueue();
         };
 
         EDCA(cSimpleModule* owner, ChannelType channelType, int maxQueueLength = 0);
@@ -127,7 +180,7 @@ public:
 
     public:
         cSimpleModule* owner;
-        std::map<t_access_category, EDCAQueue> myQueues;
+        std::array<EDCAQueue, 4> myQueues; // indexed by t_access_category
         uint32_t maxQueueSize;
         simtime_t lastStart; // when we started the last contention;
         ChannelType channelType;
@@ -315,7 +368,22 @@ protected:
 
     // Dont start contention immediately after finishing unicast TX. Wait until ack timeout/ ack Rx
     bool waitUntilAckRXorTimeout;
-    std::set<unsigned long> handledUnicastToApp;
+
+    /**
+     * @brief The unicast frames last handed to the application from one sender.
+     *
+     * A sender retransmits the frame at the head of each of its EDCA queues (one per channel type and access category)
+     * until it is acknowledged or dropped, so only the last frame received from that queue can arrive again.
+     */
+    struct LastUnicastsToApp {
+        std::array<long, 8> treeIds; ///< tree id of the last frame per channel type and access category (-1 if none), indexed by 4 * channel type + access category
+        simtime_t lastReceived; ///< when the last unicast frame of this sender arrived
+    };
+
+    // Last unicast frames handed to the application, per sender still retransmitting within duplicateDetectionTimeout.
+    std::unordered_map<LAddress::L2Type, LastUnicastsToApp> lastUnicastToApp;
+    simtime_t duplicateDetectionTimeout;
+    simtime_t lastDuplicateDetectionSweep;
 
     Mac80211pToPhy11pInterface* phy11p;
 };
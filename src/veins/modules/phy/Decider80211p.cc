@@ -32,10 +32,10 @@
 #include "veins/modules/messages/Mac80211Pkt_m.h"
 #include "veins/base/toolbox/Signal.h"
 #include "veins/modules/messages/AirFrame11p_m.h"
-#include "veins/modules/phy/NistErrorRate.h"
 #include "veins/modules/utility/ConstsPhy.h"
 
 #include "veins/base/toolbox/SignalUtils.h"
+#include "veins/base/phyLayer/InterferenceTracker.h"
 
 using namespace veins;
 
@@ -47,7 +47,7 @@ simtime_t Decider80211p::processNewSignal(AirFrame* msg)
     // get the receiving power of the Signal at start-time and center frequency
     Signal& signal = frame->getSignal();
 
-    signalStates[frame] = EXPECT_END;
+    frame->setSignalState(EXPECT_END);
 
     if (signal.smallerAtCenterFrequency(minPowerLevel)) {
 
@@ -57,6 +57,11 @@ simtime_t Decider80211p::processNewSignal(AirFrame* msg)
         if (cca(simTime(), nullptr) == false) {
             setChannelIdleStatus(false);
         }
+        else if (releaseUnderMinPowerLevel) {
+            // the frame did not turn the channel busy, so its end does not need to turn it idle again
+            frame->setSignalState(NEW);
+            return notAgain;
+        }
         return signal.getReceptionEnd();
     }
     else {
@@ -93,15 +98,16 @@ simtime_t Decider80211p::processNewSignal(AirFrame* msg)
     }
 }
 
-int Decider80211p::getSignalState(AirFrame* frame)
+bool Decider80211p::isInterferenceOnly(AirFrame* frame)
 {
+    AirFrame11p* frame11p = check_and_cast<AirFrame11p*>(frame);
+    return frame11p->getUnderMinPowerLevel() && getSignalState(frame) == NEW;
+}
 
-    if (signalStates.find(frame) == signalStates.end()) {
-        return NEW;
-    }
-    else {
-        return signalStates[frame];
-    }
+int Decider80211p::getSignalState(AirFrame* frame)
+{
+    // every receiver gets its own copy of a frame, so the state is kept in the frame itself
+    return check_and_cast<AirFrame11p*>(frame)->getSignalState();
 }
 
 DeciderResult* Decider80211p::checkIfSignalOk(AirFrame* frame)
@@ -114,13 +120,18 @@ DeciderResult* Decider80211p::checkIfSignalOk(AirFrame* frame)
 
     start = start + PHY_HDR_PREAMBLE_DURATION; // its ok if something in the training phase is broken
 
-    AirFrameVector airFrames;
-    getChannelInfo(start, end, airFrames);
-
     double noise = phy->getNoiseFloorValue();
 
     // Make sure to use the adjusted starting-point (which ignores the preamble)
-    double sinrMin = SignalUtils::getMinSINR(start, end, frame, airFrames, noise);
+    double sinrMin;
+    if (InterferenceTracker* tracker = phy->getInterferenceTracker()) {
+        sinrMin = tracker->getMinSINR(start, end, frame, noise);
+    }
+    else {
+        AirFrameVector airFrames;
+        getChannelInfo(start, end, airFrames);
+        sinrMin = SignalUtils::getMinSINR(start, end, frame, airFrames, noise);
+    }
     double snrMin;
     if (collectCollisionStats) {
         // snrMin = SignalUtils::getMinSNR(start, end, frame, noise);
@@ -172,21 +183,31 @@ DeciderResult* Decider80211p::checkIfSignalOk(AirFrame* frame)
 
 enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, double snrMin, int lengthMPDU, double bitrate)
 {
+    ASSERT(errorModel);
+
     double packetOkSinr;
     double packetOkSnr;
 
-    // compute success rate depending on mcs and bw
-    packetOkSinr = NistErrorRate::getChunkSuccessRate(bitrate, BANDWIDTH_11P, sinrMin, PHY_HDR_SERVICE_LENGTH + lengthMPDU + PHY_TAIL_LENGTH);
+    // compute success rates of the rest of the packet and (to check if it is broken) of the header in one go
+    const uint32_t packetBits = PHY_HDR_SERVICE_LENGTH + lengthMPDU + PHY_TAIL_LENGTH;
+    chunks.clear();
+    chunks.push_back({static_cast<unsigned int>(bitrate), sinrMin, packetBits});
+    chunks.push_back({static_cast<unsigned int>(PHY_HDR_BITRATE), sinrMin, PHY_HDR_PLCPSIGNAL_LENGTH});
+    // compute PER also for SNR only
+    if (collectCollisionStats) {
+        chunks.push_back({static_cast<unsigned int>(bitrate), snrMin, packetBits});
+        chunks.push_back({static_cast<unsigned int>(PHY_HDR_BITRATE), snrMin, PHY_HDR_PLCPSIGNAL_LENGTH});
+    }
+    errorModel->getChunkSuccessRates(chunks, chunkSuccessRates);
 
-    // check if header is broken
-    double headerNoError = NistErrorRate::getChunkSuccessRate(PHY_HDR_BITRATE, BANDWIDTH_11P, sinrMin, PHY_HDR_PLCPSIGNAL_LENGTH);
+    packetOkSinr = chunkSuccessRates[0];
+    double headerNoError = chunkSuccessRates[1];
 
     double headerNoErrorSnr;
-    // compute PER also for SNR only
     if (collectCollisionStats) {
 
-        packetOkSnr = NistErrorRate::getChunkSuccessRate(bitrate, BANDWIDTH_11P, snrMin, PHY_HDR_SERVICE_LENGTH + lengthMPDU + PHY_TAIL_LENGTH);
-        headerNoErrorSnr = NistErrorRate::getChunkSuccessRate(PHY_HDR_BITRATE, BANDWIDTH_11P, snrMin, PHY_HDR_PLCPSIGNAL_LENGTH);
+        packetOkSnr = chunkSuccessRates[2];
+        headerNoErrorSnr = chunkSuccessRates[3];
 
         // the probability of correct reception without considering the interference
         // MUST be greater or equal than when consider it
@@ -251,6 +272,12 @@ enum Decider80211p::PACKET_OK_RESULT Decider80211p::packetOk(double sinrMin, dou
 
 bool Decider80211p::cca(simtime_t_cref time, AirFrame* exclude)
 {
+    double minPower = phy->getNoiseFloorValue();
+
+    if (InterferenceTracker* tracker = phy->getInterferenceTracker()) {
+        // In the reference implementation only centerFrequenvy - 5e6 (half bandwidth) is checked!
+        return minPower < ccaThreshold && tracker->isChannelPowerBelowThreshold(time, centerFrequency - 5e6, ccaThreshold - minPower, exclude);
+    }
 
     AirFrameVector airFrames;
 
@@ -259,7 +286,6 @@ bool Decider80211p::cca(simtime_t_cref time, AirFrame* exclude)
 
     // In the reference implementation only centerFrequenvy - 5e6 (half bandwidth) is checked!
     // Although this is wrong, the same is done here to reproduce original results
-    double minPower = phy->getNoiseFloorValue();
     bool isChannelIdle = minPower < ccaThreshold;
     if (airFrames.size() > 0) {
         size_t usedFreqIndex = airFrames.front()->getSignal().getSpectrum().indexOf(centerFrequency - 5e6);
@@ -282,7 +308,7 @@ simtime_t Decider80211p::processSignalEnd(AirFrame* msg)
     bool whileSending = false;
 
     // remove this frame from our current signals
-    signalStates.erase(frame);
+    frame->setSignalState(NEW);
 
     DeciderResult* result;
 
@@ -28,6 +28,7 @@
 #include "veins/modules/utility/Consts80211p.h"
 #include "veins/modules/mac/ieee80211p/Mac80211pToPhy11pInterface.h"
 #include "veins/modules/phy/Decider80211pToPhy80211pInterface.h"
+#include "veins/modules/phy/NistErrorModel80211p.h"
 
 namespace veins {
 
@@ -106,7 +107,6 @@ protected:
 
     std::string myPath;
     Decider80211pToPhy80211pInterface* phy11p;
-    std::map<AirFrame*, int> signalStates;
 
     /** @brief enable/disable statistics collection for collisions
      *
@@ -122,6 +122,16 @@ protected:
     /** @brief notify PHY-RXSTART.indication  */
     bool notifyRxStart;
 
+    /** @brief release frames under minPowerLevel which do not turn the channel busy right away, instead of processing their end */
+    bool releaseUnderMinPowerLevel;
+
+    /** @brief the model of the probability of receiving header and rest of a frame without error */
+    std::unique_ptr<ErrorModel80211p> errorModel;
+
+    /** @brief the chunks (and their success rates) of the frame packetOk() currently decides on */
+    std::vector<ErrorModel80211p::Chunk> chunks;
+    std::vector<double> chunkSuccessRates;
+
 protected:
     /**
      * @brief Checks a mapping against a specific threshold (element-wise).
@@ -164,6 +174,8 @@ public:
         , collectCollisionStats(collectCollisionStatistics)
         , collisions(0)
         , notifyRxStart(false)
+        , releaseUnderMinPowerLevel(false)
+        , errorModel(make_unique<NistErrorModel80211p>())
     {
         phy11p = dynamic_cast<Decider80211pToPhy80211pInterface*>(phy);
         ASSERT(phy11p);
@@ -176,6 +188,11 @@ public:
 
     bool cca(simtime_t_cref, AirFrame*);
     int getSignalState(AirFrame* frame) override;
+
+    /**
+     * @brief Returns true for frames under minPowerLevel which have been released, see setReleaseUnderMinPowerLevel()
+     */
+    bool isInterferenceOnly(AirFrame* frame) override;
     ~Decider80211p() override;
 
     void changeFrequency(double freq);
@@ -192,6 +209,14 @@ public:
 
     void setChannelIdleStatus(bool isIdle) override;
 
+    /**
+     * @brief sets the model of the probability of receiving header and rest of a frame without error
+     */
+    void setErrorModel(std::unique_ptr<ErrorModel80211p> errorModel)
+    {
+        this->errorModel = std::move(errorModel);
+    }
+
     /**
      * @brief invoke this method when the phy layer is also finalized,
      * so that statistics recorded by the decider can be written to
@@ -214,6 +239,18 @@ public:
      * @brief notify PHY-RXSTART.indication
      */
     void setNotifyRxStart(bool enable);
+
+    /**
+     * @brief enables/disables releasing frames under minPowerLevel right after their start
+     *
+     * Such frames are never decoded, so they only matter as interference and for channel sensing.
+     * If a frame does not turn the channel busy, it is released and its end is not processed:
+     * the channel can then only turn idle at the end of a frame that has not been released.
+     */
+    void setReleaseUnderMinPowerLevel(bool enable)
+    {
+        releaseUnderMinPowerLevel = enable;
+    }
 };
 
 } // namespace veins
@@ -0,0 +1,81 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "veins/veins.h"
+
+namespace veins {
+
+/**
+ * @brief Interface for models of the probability of receiving (part of) an IEEE 802.11p frame without error.
+ *
+ * Decider80211p asks the model for the success rate of the PLCP header and of the rest of a frame.
+ * The model is selected in the decider configuration file, next to the Decider element, e.g.:
+ * @verbatim
+    <ErrorModel type="TableErrorModel80211p">
+        <parameter name="file" type="string" value="per.csv"/>
+        <parameter name="referenceLength" type="long" value="2400"/>
+    </ErrorModel>
+   @endverbatim
+ * If no ErrorModel is configured, NistErrorModel80211p is used.
+ *
+ * @ingroup decider
+ */
+class VEINS_API ErrorModel80211p {
+public:
+    /**
+     * @brief A number of bits sent at some datarate, received at some SNR (or SINR).
+     */
+    struct Chunk {
+        unsigned int datarate;
+        double snr_mW;
+        uint32_t nbits;
+    };
+
+    virtual ~ErrorModel80211p() = default;
+
+    /**
+     * Returns the probability of receiving the given chunk without error.
+     */
+    virtual double getChunkSuccessRate(const Chunk& chunk) const = 0;
+
+    /**
+     * Stores the probability of receiving each of the given chunks without error in successRates.
+     *
+     * Models can override this to evaluate several chunks at once.
+     * The default implementation calls getChunkSuccessRate() for each chunk in turn.
+     */
+    virtual void getChunkSuccessRates(const std::vector<Chunk>& chunks, std::vector<double>& successRates) const
+    {
+        successRates.resize(chunks.size());
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            successRates[i] = getChunkSuccessRate(chunks[i]);
+        }
+    }
+};
+
+} // namespace veins
@@ -0,0 +1,42 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/modules/phy/NistErrorModel80211p.h"
+
+#include "veins/modules/phy/NistErrorRate.h"
+#include "veins/modules/utility/Consts80211p.h"
+
+using namespace veins;
+
+NistErrorModel80211p::NistErrorModel80211p(std::shared_ptr<const NistErrorRateTable> table)
+    : table(std::move(table))
+{
+}
+
+double NistErrorModel80211p::getChunkSuccessRate(const Chunk& chunk) const
+{
+    if (table) {
+        return table->getChunkSuccessRate(chunk.datarate, BANDWIDTH_11P, chunk.snr_mW, chunk.nbits);
+    }
+    return NistErrorRate::getChunkSuccessRate(chunk.datarate, BANDWIDTH_11P, chunk.snr_mW, chunk.nbits);
+}
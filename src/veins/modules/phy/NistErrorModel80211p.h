@@ -0,0 +1,61 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <memory>
+
+#include "veins/veins.h"
+
+#include "veins/modules/phy/ErrorModel80211p.h"
+#include "veins/modules/phy/NistErrorRateTable.h"
+
+namespace veins {
+
+/**
+ * @brief Error model of the nist wifi model of ns-3, as implemented by NistErrorRate.
+ *
+ * Optionally looks up success rates in a NistErrorRateTable instead of computing them analytically:
+ * @verbatim
+    <ErrorModel type="NistErrorModel80211p">
+        <!-- maximal deviation from the analytic success rate; 0 computes them analytically -->
+        <parameter name="tableMaxError" type="double" value="1e-6"/>
+    </ErrorModel>
+   @endverbatim
+ *
+ * @ingroup decider
+ */
+class VEINS_API NistErrorModel80211p : public ErrorModel80211p {
+public:
+    /**
+     * @param table if set, success rates are looked up in this table instead of computed analytically
+     */
+    explicit NistErrorModel80211p(std::shared_ptr<const NistErrorRateTable> table = nullptr);
+
+    double getChunkSuccessRate(const Chunk& chunk) const override;
+
+protected:
+    std::shared_ptr<const NistErrorRateTable> table;
+};
+
+} // namespace veins
@@ -159,3 +159,50 @@ double NistErrorRate::getChunkSuccessRate(unsigned int datarate, enum Bandwidth
 
     return 0;
 }
+
+double NistErrorRate::getCodedBitErrorRate(MCS mcs, double snr_mW)
+{
+    double ber;
+    uint32_t bValue;
+    switch (mcs) {
+    case MCS::ofdm_bpsk_r_1_2:
+        ber = getBpskBer(snr_mW);
+        bValue = 1;
+        break;
+    case MCS::ofdm_bpsk_r_3_4:
+        ber = getBpskBer(snr_mW);
+        bValue = 3;
+        break;
+    case MCS::ofdm_qpsk_r_1_2:
+        ber = getQpskBer(snr_mW);
+        bValue = 1;
+        break;
+    case MCS::ofdm_qpsk_r_3_4:
+        ber = getQpskBer(snr_mW);
+        bValue = 3;
+        break;
+    case MCS::ofdm_qam16_r_1_2:
+        ber = get16QamBer(snr_mW);
+        bValue = 1;
+        break;
+    case MCS::ofdm_qam16_r_3_4:
+        ber = get16QamBer(snr_mW);
+        bValue = 3;
+        break;
+    case MCS::ofdm_qam64_r_2_3:
+        ber = get64QamBer(snr_mW);
+        bValue = 2;
+        break;
+    case MCS::ofdm_qam64_r_3_4:
+        ber = get64QamBer(snr_mW);
+        bValue = 3;
+        break;
+    default:
+        ASSERT2(false, "Invalid MCS chosen");
+        return 1;
+    }
+    if (ber == 0.0) {
+        return 0;
+    }
+    return calculatePe(ber, bValue);
+}
@@ -37,6 +37,18 @@ public:
 
     static double getChunkSuccessRate(unsigned int datarate, enum Bandwidth bw, double snr_mW, uint32_t nbits);
 
+    /**
+     * Return the probability of a bit error after decoding with the given MCS at the given SNR.
+     *
+     * The chunk success rate for nbits is (1 - min(pe, 1))^nbits of the returned pe.
+     * Unlike the chunk success rate, pe is not clamped to 1, so it stays a smooth function of the SNR.
+     *
+     * \param mcs the modulation and coding scheme
+     * \param snr_mW snr value
+     * \return the (unclamped) coded bit error rate
+     */
+    static double getCodedBitErrorRate(MCS mcs, double snr_mW);
+
 private:
     /**
      * Return the coded BER for the given p and b.
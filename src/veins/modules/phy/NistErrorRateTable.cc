@@ -0,0 +1,150 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/modules/phy/NistErrorRateTable.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <utility>
+
+#include "veins/modules/phy/NistErrorRate.h"
+
+using namespace veins;
+
+namespace {
+
+const MCS tabulatedMcs[] = {
+    MCS::ofdm_bpsk_r_1_2,
+    MCS::ofdm_bpsk_r_3_4,
+    MCS::ofdm_qpsk_r_1_2,
+    MCS::ofdm_qpsk_r_3_4,
+    MCS::ofdm_qam16_r_1_2,
+    MCS::ofdm_qam16_r_3_4,
+    MCS::ofdm_qam64_r_2_3,
+    MCS::ofdm_qam64_r_3_4,
+};
+
+// stop refining a table at this step [dB]
+const double minStep = 1e-4;
+
+double getLogPe(MCS mcs, double snrDb)
+{
+    return std::log(NistErrorRate::getCodedBitErrorRate(mcs, std::pow(10.0, snrDb / 10)));
+}
+
+} // namespace
+
+constexpr double NistErrorRateTable::minSnrDb;
+constexpr double NistErrorRateTable::maxSnrDb;
+
+NistErrorRateTable::NistErrorRateTable(double maxError, uint32_t maxBits)
+    : maxError(maxError)
+    , maxBits(maxBits)
+{
+    if (!(maxError > 0)) {
+        throw cRuntimeError("NistErrorRateTable: maxError must be positive, not %f", maxError);
+    }
+    for (auto mcs : tabulatedMcs) {
+        tables[static_cast<size_t>(mcs)] = buildTable(mcs);
+    }
+}
+
+std::shared_ptr<const NistErrorRateTable> NistErrorRateTable::get(double maxError, uint32_t maxBits)
+{
+    static std::map<std::pair<double, uint32_t>, std::shared_ptr<const NistErrorRateTable>> tables;
+    auto& table = tables[{maxError, maxBits}];
+    if (!table) {
+        table = std::make_shared<const NistErrorRateTable>(maxError, maxBits);
+    }
+    return table;
+}
+
+double NistErrorRateTable::getMaxSuccessRateDeviation(double pe, double approxPe, uint32_t maxBits)
+{
+    // compare exp(-n a) to exp(-n b), the difference of which peaks at n = ln(b / a) / (b - a)
+    double a = -std::log1p(-std::min(pe, 1.0));
+    double b = -std::log1p(-std::min(approxPe, 1.0));
+    if (a > b) std::swap(a, b);
+    if (a == b) return 0;
+    if (std::isinf(b)) return std::exp(-a);
+    double n = (a == 0) ? maxBits : std::log(b / a) / (b - a);
+    n = std::min(std::max(n, 1.0), static_cast<double>(maxBits));
+    return std::exp(-n * a) - std::exp(-n * b);
+}
+
+NistErrorRateTable::Table NistErrorRateTable::buildTable(MCS mcs) const
+{
+    // refine the grid until interpolating halfway between grid points is within (half) the error bound
+    Table table;
+    for (table.step = 0.1; table.step >= minStep; table.step /= 2) {
+        size_t count = static_cast<size_t>(std::ceil((maxSnrDb - minSnrDb) / table.step)) + 1;
+        table.logPe.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            table.logPe[i] = getLogPe(mcs, minSnrDb + i * table.step);
+        }
+
+        bool accurate = true;
+        for (size_t i = 0; accurate && i + 1 < count; ++i) {
+            if (!std::isfinite(table.logPe[i]) || !std::isfinite(table.logPe[i + 1])) continue;
+            double approxPe = std::exp((table.logPe[i] + table.logPe[i + 1]) / 2);
+            double pe = std::exp(getLogPe(mcs, minSnrDb + (i + 0.5) * table.step));
+            accurate = getMaxSuccessRateDeviation(pe, approxPe, maxBits) <= maxError / 2;
+        }
+        if (accurate) return table;
+    }
+    throw cRuntimeError("NistErrorRateTable: cannot reach maxError %g", maxError);
+}
+
+double NistErrorRateTable::getStep(MCS mcs) const
+{
+    return tables.at(static_cast<size_t>(mcs)).step;
+}
+
+double NistErrorRateTable::getChunkSuccessRate(unsigned int datarate, enum Bandwidth bw, double snr_mW, uint32_t nbits) const
+{
+    if (nbits > maxBits) {
+        return NistErrorRate::getChunkSuccessRate(datarate, bw, snr_mW, nbits);
+    }
+
+    const Table& table = tables.at(static_cast<size_t>(getMCS(datarate, bw)));
+    double pos = (10 * std::log10(snr_mW) - minSnrDb) / table.step;
+    if (!(pos >= 0 && pos < table.logPe.size() - 1)) {
+        return NistErrorRate::getChunkSuccessRate(datarate, bw, snr_mW, nbits);
+    }
+
+    size_t i = static_cast<size_t>(pos);
+    double y0 = table.logPe[i];
+    double y1 = table.logPe[i + 1];
+    // pe decreases with the SNR, so it is zero beyond the first grid point it is zero at
+    if (y0 == -std::numeric_limits<double>::infinity()) {
+        return 1;
+    }
+    if (!std::isfinite(y0) || !std::isfinite(y1)) {
+        return NistErrorRate::getChunkSuccessRate(datarate, bw, snr_mW, nbits);
+    }
+
+    double pe = std::min(std::exp(y0 + (pos - i) * (y1 - y0)), 1.0);
+    return std::pow(1 - pe, static_cast<double>(nbits));
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/modules/utility/ConstsPhy.h"
+
+namespace veins {
+
+/**
+ * @brief Table-driven approximation of NistErrorRate::getChunkSuccessRate.
+ *
+ * For every MCS, stores the logarithm of the coded bit error rate pe over a uniform grid of SNRs in dB, and interpolates linearly in between.
+ * As the chunk success rate is (1 - pe)^nbits, one table per MCS serves all chunk lengths.
+ *
+ * The grid of each MCS is refined until the chunk success rate deviates from the analytic result by at most maxError for any chunk of up to maxBits bits.
+ * SNRs outside the tabulated range and longer chunks are computed analytically.
+ *
+ * @see NistErrorRate
+ */
+class VEINS_API NistErrorRateTable {
+public:
+    /**
+     * Build the tables for the given error bound.
+     *
+     * @param maxError the maximal absolute deviation of a chunk success rate from its analytic value
+     * @param maxBits the maximal chunk length the error bound holds for
+     */
+    NistErrorRateTable(double maxError, uint32_t maxBits = 65536);
+
+    /**
+     * Return a (shared) table for the given error bound, building it on first use.
+     */
+    static std::shared_ptr<const NistErrorRateTable> get(double maxError, uint32_t maxBits = 65536);
+
+    /**
+     * Approximate NistErrorRate::getChunkSuccessRate.
+     */
+    double getChunkSuccessRate(unsigned int datarate, enum Bandwidth bw, double snr_mW, uint32_t nbits) const;
+
+    /**
+     * Return the SNR step (in dB) of the table for the given MCS.
+     */
+    double getStep(MCS mcs) const;
+
+    static constexpr double minSnrDb = -10; ///< The smallest tabulated SNR in dB.
+    static constexpr double maxSnrDb = 50; ///< The largest tabulated SNR in dB.
+
+private:
+    struct Table {
+        double step = 0; ///< SNR step in dB
+        std::vector<double> logPe; ///< log(pe) at SNR minSnrDb + i * step
+    };
+
+    /**
+     * Returns the largest deviation of (1 - pe)^n from (1 - approxPe)^n for any n in [1, maxBits].
+     */
+    static double getMaxSuccessRateDeviation(double pe, double approxPe, uint32_t maxBits);
+
+    Table buildTable(MCS mcs) const;
+
+    double maxError;
+    uint32_t maxBits;
+    std::array<Table, 8> tables;
+};
+
+} // namespace veins
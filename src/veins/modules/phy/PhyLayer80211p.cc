@@ -28,6 +28,8 @@
 #include "veins/modules/phy/PhyLayer80211p.h"
 
 #include "veins/modules/phy/Decider80211p.h"
+#include "veins/modules/phy/NistErrorModel80211p.h"
+#include "veins/modules/phy/TableErrorModel80211p.h"
 #include "veins/modules/analogueModel/SimplePathlossModel.h"
 #include "veins/modules/analogueModel/BreakpointPathlossModel.h"
 #include "veins/modules/analogueModel/PERModel.h"
@@ -53,10 +55,14 @@ void PhyLayer80211p::initialize(int stage)
         ccaThreshold = pow(10, par("ccaThreshold").doubleValue() / 10);
         allowTxDuringRx = par("allowTxDuringRx").boolValue();
         collectCollisionStatistics = par("collectCollisionStatistics").boolValue();
+        releaseUnderMinPowerLevel = par("releaseUnderMinPowerLevel").boolValue();
+
+        narrowband = par("narrowband").boolValue();
 
         // Create frequency mappings and initialize spectrum for signal representation
         Spectrum::Frequencies freqs;
         for (auto& channel : IEEE80211ChannelFrequencies) {
+            if (narrowband && channel.first != Channel::cch) continue;
             freqs.push_back(channel.second - 5e6);
             freqs.push_back(channel.second);
             freqs.push_back(channel.second + 5e6);
@@ -254,6 +260,9 @@ unique_ptr<AnalogueModel> PhyLayer80211p::initializeVehicleObstacleShadowing(Par
 unique_ptr<Decider> PhyLayer80211p::initializeDecider80211p(ParameterMap& params)
 {
     double centerFreq = params["centerFrequency"];
+    if (narrowband && centerFreq != IEEE80211ChannelFrequencies.at(Channel::cch)) {
+        throw cRuntimeError("Decider80211p centerFrequency must be that of the control channel in narrowband mode");
+    }
     auto myIndex = -1;
     auto host = findHost();
     if (host->isVector()) {
@@ -261,14 +270,89 @@ unique_ptr<Decider> PhyLayer80211p::initializeDecider80211p(ParameterMap& params
     }
     auto dec = make_unique<Decider80211p>(this, this, minPowerLevel, ccaThreshold, allowTxDuringRx, centerFreq, myIndex, collectCollisionStatistics);
     dec->setPath(getParentModule()->getFullPath());
+    dec->setReleaseUnderMinPowerLevel(releaseUnderMinPowerLevel);
+    dec->setErrorModel(initializeErrorModel(par("decider").xmlValue()));
     return unique_ptr<Decider>(std::move(dec));
 }
 
+unique_ptr<ErrorModel80211p> PhyLayer80211p::initializeErrorModel(cXMLElement* xmlConfig)
+{
+    cXMLElementList errorModelList = xmlConfig->getElementsByTagName("ErrorModel");
+
+    if (errorModelList.empty()) {
+        ParameterMap params;
+        return getErrorModelFromName("NistErrorModel80211p", params, nullptr);
+    }
+
+    if (errorModelList.size() > 1) {
+        throw cRuntimeError("More than one error model configuration found in configuration file.");
+    }
+
+    cXMLElement* errorModelData = errorModelList.front();
+
+    const char* name = errorModelData->getAttribute("type");
+
+    if (name == nullptr) {
+        throw cRuntimeError("Could not read type of error model from configuration file.");
+    }
+
+    ParameterMap params;
+    getParametersFromXML(errorModelData, params);
+
+    auto errorModel = getErrorModelFromName(name, params, errorModelData);
+
+    if (errorModel == nullptr) {
+        throw cRuntimeError("Could not find an error model with the name \"%s\".", name);
+    }
+
+    EV_TRACE << "ErrorModel \"" << name << "\" loaded." << endl;
+    return errorModel;
+}
+
+unique_ptr<ErrorModel80211p> PhyLayer80211p::getErrorModelFromName(std::string name, ParameterMap& params, cXMLElement* xmlData)
+{
+    if (name == "NistErrorModel80211p") {
+        double tableMaxError = par("errorRateTableMaxError").doubleValue();
+        ParameterMap::iterator it = params.find("tableMaxError");
+        if (it != params.end()) {
+            tableMaxError = it->second.doubleValue();
+        }
+        return make_unique<NistErrorModel80211p>(tableMaxError > 0 ? NistErrorRateTable::get(tableMaxError) : nullptr);
+    }
+    else if (name == "TableErrorModel80211p") {
+        ParameterMap::iterator it = params.find("file");
+        if (it == params.end()) {
+            throw cRuntimeError("TableErrorModel80211p requires parameter \"file\"");
+        }
+        std::string fileName = it->second.stringValue();
+        // resolve relative paths against the directory of the configuration file
+        const char* configFileName = xmlData ? xmlData->getSourceFileName() : nullptr;
+        if (configFileName && !fileName.empty() && fileName[0] != '/') {
+            std::string configFile = configFileName;
+            auto slash = configFile.find_last_of('/');
+            if (slash != std::string::npos) {
+                fileName = configFile.substr(0, slash + 1) + fileName;
+            }
+        }
+
+        it = params.find("referenceLength");
+        if (it == params.end()) {
+            throw cRuntimeError("TableErrorModel80211p requires parameter \"referenceLength\"");
+        }
+        return TableErrorModel80211p::fromFile(fileName, it->second.longValue());
+    }
+    return nullptr;
+}
+
 void PhyLayer80211p::changeListeningChannel(Channel channel)
 {
     Decider80211p* dec = dynamic_cast<Decider80211p*>(decider.get());
     ASSERT(dec);
 
+    if (narrowband && channel != Channel::cch) {
+        throw cRuntimeError("Cannot listen on channel %d: narrowband mode only supports the control channel", static_cast<int>(channel));
+    }
+
     double freq = IEEE80211ChannelFrequencies.at(channel);
     dec->changeFrequency(freq);
 }
@@ -319,6 +403,10 @@ void PhyLayer80211p::attachSignal(AirFrame* airFrame, cObject* ctrlInfo)
 {
     const auto ctrlInfo11p = check_and_cast<MacToPhyControlInfo11p*>(ctrlInfo);
 
+    if (narrowband && ctrlInfo11p->channelNr != Channel::cch) {
+        throw cRuntimeError("Cannot transmit on channel %d: narrowband mode only supports the control channel", static_cast<int>(ctrlInfo11p->channelNr));
+    }
+
     const auto duration = getFrameDuration(airFrame->getEncapsulatedPacket()->getBitLength(), ctrlInfo11p->mcs);
     ASSERT(duration > 0);
     Signal signal(overallSpectrum, simTime(), duration);
@@ -385,3 +473,8 @@ simtime_t PhyLayer80211p::getFrameDuration(int payloadLengthBits, MCS mcs) const
     // calculate frame duration according to Equation (17-29) of the IEEE 802.11-2007 standard
     return PHY_HDR_PREAMBLE_DURATION + PHY_HDR_PLCPSIGNAL_DURATION + T_SYM_80211P * ceil(static_cast<double>(16 + payloadLengthBits + 6) / (ndbps));
 }
+
+double PhyLayer80211p::getLowestRelevantPower() const
+{
+    return std::min(BasePhyLayer::getLowestRelevantPower(), ccaThreshold);
+}
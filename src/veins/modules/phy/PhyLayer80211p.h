@@ -73,12 +73,23 @@ protected:
     /** @brief enable/disable detection of packet collisions */
     bool collectCollisionStatistics;
 
+    /** @brief release frames under minPowerLevel right after their start. See Decider80211p for details */
+    bool releaseUnderMinPowerLevel;
+
     /** @brief allows/disallows interruption of current reception for txing
      *
      * See detailed description in Decider80211p
      */
     bool allowTxDuringRx;
 
+    /** @brief restrict every Signal to the samples of the control channel
+     *
+     * Signals then only carry the data range and center frequency of the control channel,
+     * so analogue models and the Decider work on 3 instead of 15 samples.
+     * Only supports single-channel operation, i.e., transmitting and listening on the control channel.
+     */
+    bool narrowband;
+
     enum ProtocolIds {
         IEEE_80211 = 12123
     };
@@ -154,6 +165,22 @@ protected:
      */
     virtual std::unique_ptr<Decider> initializeDecider80211p(ParameterMap& params);
 
+    /**
+     * @brief Creates the ErrorModel80211p configured in the passed XML-config data, or a NistErrorModel80211p if there is none.
+     */
+    std::unique_ptr<ErrorModel80211p> initializeErrorModel(cXMLElement* xmlConfig);
+
+    /**
+     * @brief Creates and returns an instance of the ErrorModel80211p with the
+     * specified name.
+     *
+     * Is able to initialize the following ErrorModels:
+     *
+     * - NistErrorModel80211p
+     * - TableErrorModel80211p
+     */
+    virtual std::unique_ptr<ErrorModel80211p> getErrorModelFromName(std::string name, ParameterMap& params, cXMLElement* xmlData);
+
     /**
      * Create a protocol-specific AirFrame
      * Overloaded to create a specialize AirFrame11p.
@@ -175,6 +202,11 @@ protected:
 
     virtual simtime_t getFrameDuration(int payloadLengthBits, MCS mcs) const override;
 
+    /**
+     * Adds the CCA threshold, against which Decider80211p compares the summed power of all frames.
+     */
+    double getLowestRelevantPower() const override;
+
     void handleSelfMessage(cMessage* msg) override;
     int getRadioState() override;
     simtime_t setRadioState(int rs) override;
@@ -22,6 +22,9 @@
 //
 
 #include "veins/modules/phy/SampledAntenna1D.h"
+
+#include <algorithm>
+
 #include "veins/base/utils/FWMath.h"
 
 using namespace veins;
@@ -118,6 +121,11 @@ double SampledAntenna1D::getGain(Coord ownPos, Coord ownOrient, Coord otherPos)
     return FWMath::dBm2mW(gainValue);
 }
 
+double SampledAntenna1D::getMaxGain()
+{
+    return FWMath::dBm2mW(*std::max_element(antennaGains.begin(), antennaGains.end()));
+}
+
 double SampledAntenna1D::getLastAngle()
 {
     return lastAngle / M_PI * 180.0;
@@ -98,6 +98,11 @@ public:
      */
     double getGain(Coord ownPos, Coord ownOrient, Coord otherPos) override;
 
+    /**
+     * @brief Returns the largest sample (interpolation never exceeds it).
+     */
+    double getMaxGain() override;
+
     double getLastAngle() override;
 
 private:
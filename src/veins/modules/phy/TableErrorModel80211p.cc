@@ -0,0 +1,161 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "veins/modules/phy/TableErrorModel80211p.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <utility>
+
+using namespace veins;
+
+TableErrorModel80211p::TableErrorModel80211p(std::istream& csv, uint32_t referenceLength, const std::string& sourceName)
+    : table(parse(csv, referenceLength, sourceName))
+{
+}
+
+TableErrorModel80211p::TableErrorModel80211p(std::shared_ptr<const Table> table)
+    : table(std::move(table))
+{
+    ASSERT(this->table);
+}
+
+std::shared_ptr<const TableErrorModel80211p::Table> TableErrorModel80211p::parse(std::istream& csv, uint32_t referenceLength, const std::string& sourceName)
+{
+    if (referenceLength == 0) {
+        throw cRuntimeError("TableErrorModel80211p: referenceLength must be positive");
+    }
+
+    std::map<unsigned int, std::vector<std::pair<double, double>>> points;
+    std::string line;
+    for (int lineNumber = 1; std::getline(csv, line); ++lineNumber) {
+        std::replace(line.begin(), line.end(), ',', ' ');
+        std::istringstream fields(line);
+        std::string first;
+        if (!(fields >> first) || first[0] == '#') continue;
+
+        std::istringstream firstField(first);
+        double datarate;
+        double sinrDb;
+        double per;
+        if (!(firstField >> datarate)) {
+            // a header line
+            if (points.empty()) continue;
+            throw cRuntimeError("TableErrorModel80211p: %s line %d: cannot parse datarate \"%s\"", sourceName.c_str(), lineNumber, first.c_str());
+        }
+        if (!(fields >> sinrDb >> per)) {
+            throw cRuntimeError("TableErrorModel80211p: %s line %d: expected datarate, SINR, and PER", sourceName.c_str(), lineNumber);
+        }
+        if (!(per >= 0 && per <= 1)) {
+            throw cRuntimeError("TableErrorModel80211p: %s line %d: PER %f is not within [0, 1]", sourceName.c_str(), lineNumber, per);
+        }
+        points[static_cast<unsigned int>(datarate)].emplace_back(sinrDb, per);
+    }
+    if (points.empty()) {
+        throw cRuntimeError("TableErrorModel80211p: %s contains no PER curves", sourceName.c_str());
+    }
+
+    auto table = std::make_shared<Table>();
+    table->referenceLength = referenceLength;
+    for (auto& datarateAndPoints : points) {
+        auto& curvePoints = datarateAndPoints.second;
+        std::sort(curvePoints.begin(), curvePoints.end());
+        Curve& curve = table->curves[datarateAndPoints.first];
+        for (auto& point : curvePoints) {
+            if (!curve.sinrDb.empty() && curve.sinrDb.back() == point.first) {
+                throw cRuntimeError("TableErrorModel80211p: %s contains more than one PER for datarate %u at %f dB", sourceName.c_str(), datarateAndPoints.first, point.first);
+            }
+            curve.sinrDb.push_back(point.first);
+            curve.per.push_back(point.second);
+        }
+    }
+    return table;
+}
+
+std::shared_ptr<const TableErrorModel80211p::Table> TableErrorModel80211p::getTable(const std::string& fileName, uint32_t referenceLength)
+{
+    static std::map<std::pair<std::string, uint32_t>, std::shared_ptr<const Table>> tables;
+    auto& table = tables[{fileName, referenceLength}];
+    if (!table) {
+        std::ifstream csv(fileName);
+        if (!csv) {
+            throw cRuntimeError("TableErrorModel80211p: cannot open \"%s\"", fileName.c_str());
+        }
+        table = parse(csv, referenceLength, fileName);
+    }
+    return table;
+}
+
+std::unique_ptr<TableErrorModel80211p> TableErrorModel80211p::fromFile(const std::string& fileName, uint32_t referenceLength)
+{
+    return make_unique<TableErrorModel80211p>(getTable(fileName, referenceLength));
+}
+
+const TableErrorModel80211p::Curve& TableErrorModel80211p::getCurve(unsigned int datarate) const
+{
+    auto it = table->curves.find(datarate);
+    if (it == table->curves.end()) {
+        throw cRuntimeError("TableErrorModel80211p: no PER curve for datarate %u", datarate);
+    }
+    return it->second;
+}
+
+double TableErrorModel80211p::getChunkSuccessRate(const Curve& curve, const Chunk& chunk) const
+{
+    double sinrDb = 10 * std::log10(chunk.snr_mW);
+
+    double per;
+    auto upper = std::upper_bound(curve.sinrDb.begin(), curve.sinrDb.end(), sinrDb);
+    if (upper == curve.sinrDb.begin()) {
+        per = curve.per.front();
+    }
+    else if (upper == curve.sinrDb.end()) {
+        per = curve.per.back();
+    }
+    else {
+        size_t i = upper - curve.sinrDb.begin();
+        double t = (sinrDb - curve.sinrDb[i - 1]) / (curve.sinrDb[i] - curve.sinrDb[i - 1]);
+        per = curve.per[i - 1] + t * (curve.per[i] - curve.per[i - 1]);
+    }
+
+    return std::pow(1 - per, static_cast<double>(chunk.nbits) / table->referenceLength);
+}
+
+double TableErrorModel80211p::getChunkSuccessRate(const Chunk& chunk) const
+{
+    return getChunkSuccessRate(getCurve(chunk.datarate), chunk);
+}
+
+void TableErrorModel80211p::getChunkSuccessRates(const std::vector<Chunk>& chunks, std::vector<double>& successRates) const
+{
+    successRates.resize(chunks.size());
+    const Curve* curve = nullptr;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (i == 0 || chunks[i].datarate != chunks[i - 1].datarate) {
+            curve = &getCurve(chunks[i].datarate);
+        }
+        successRates[i] = getChunkSuccessRate(*curve, chunks[i]);
+    }
+}
@@ -0,0 +1,129 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#pragma once
+
+#include <istream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "veins/veins.h"
+
+#include "veins/modules/phy/ErrorModel80211p.h"
+
+namespace veins {
+
+/**
+ * @brief Error model interpolating packet error rate (PER) curves, e.g., as measured in field trials.
+ *
+ * Curves are read from a CSV file with one point per line, given as datarate (in bit/s), SINR (in dB) and PER:
+ * @verbatim
+    # datarate,sinr_db,per
+    6000000,2.0,0.95
+    6000000,4.0,0.41
+    6000000,6.0,0.02
+   @endverbatim
+ * Empty lines, lines starting with '#', and a header line are skipped.
+ * Between points, the PER is interpolated linearly; beyond the first (last) point of a curve, the PER of that point is used.
+ *
+ * All PERs are assumed to be measured for chunks of referenceLength bits.
+ * Chunks of nbits bits are received without error with probability (1 - PER)^(nbits / referenceLength).
+ *
+ * An example config.xml for this ErrorModel can be the following:
+ * @verbatim
+    <ErrorModel type="TableErrorModel80211p">
+        <!-- path to the CSV file, relative to this file -->
+        <parameter name="file" type="string" value="per.csv"/>
+        <!-- length (in bits) of the chunks the PERs were measured for -->
+        <parameter name="referenceLength" type="long" value="2400"/>
+    </ErrorModel>
+   @endverbatim
+ *
+ * @ingroup decider
+ */
+class VEINS_API TableErrorModel80211p : public ErrorModel80211p {
+public:
+    /**
+     * @brief Points of a PER curve, ordered by SINR.
+     */
+    struct Curve {
+        std::vector<double> sinrDb;
+        std::vector<double> per;
+    };
+
+    /**
+     * @brief The PER curves read from a CSV source, which can be shared by any number of TableErrorModel80211p.
+     */
+    struct Table {
+        uint32_t referenceLength;
+        std::map<unsigned int, Curve> curves; ///< PER curves by datarate
+    };
+
+    /**
+     * Read the PER curves from the given CSV stream.
+     *
+     * @param csv the CSV contents
+     * @param referenceLength the number of bits the PERs were measured for
+     * @param sourceName the name of the CSV source, for error messages
+     */
+    TableErrorModel80211p(std::istream& csv, uint32_t referenceLength, const std::string& sourceName = "CSV");
+
+    /**
+     * Use the given (shared) PER curves.
+     */
+    explicit TableErrorModel80211p(std::shared_ptr<const Table> table);
+
+    /**
+     * Read the PER curves from the given CSV stream.
+     */
+    static std::shared_ptr<const Table> parse(std::istream& csv, uint32_t referenceLength, const std::string& sourceName = "CSV");
+
+    /**
+     * Returns the PER curves of the given CSV file.
+     *
+     * Every file is read only once per referenceLength; later calls share the curves read first.
+     */
+    static std::shared_ptr<const Table> getTable(const std::string& fileName, uint32_t referenceLength);
+
+    /**
+     * Use the PER curves of the given CSV file, as returned by getTable().
+     */
+    static std::unique_ptr<TableErrorModel80211p> fromFile(const std::string& fileName, uint32_t referenceLength);
+
+    double getChunkSuccessRate(const Chunk& chunk) const override;
+
+    /**
+     * Evaluates all chunks, looking up the curve only once for consecutive chunks of the same datarate.
+     */
+    void getChunkSuccessRates(const std::vector<Chunk>& chunks, std::vector<double>& successRates) const override;
+
+protected:
+    const Curve& getCurve(unsigned int datarate) const;
+    double getChunkSuccessRate(const Curve& curve, const Chunk& chunk) const;
+
+    std::shared_ptr<const Table> table;
+};
+
+} // namespace veins
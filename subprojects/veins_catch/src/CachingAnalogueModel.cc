@@ -0,0 +1,217 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include "veins/base/phyLayer/CachingAnalogueModel.h"
+#include "veins/base/toolbox/Spectrum.h"
+#include "veins/base/toolbox/Signal.h"
+#include "testutils/Simulation.h"
+#include "testutils/Component.h"
+
+using namespace veins;
+
+namespace {
+
+/**
+ * Attenuates by the distance between sender and receiver and counts how often it was asked to.
+ */
+class CountingPathlossModel : public AnalogueModel {
+public:
+    CountingPathlossModel(cComponent* owner, int& numFiltered)
+        : AnalogueModel(owner)
+        , numFiltered(numFiltered)
+    {
+    }
+
+    void filterSignal(Signal* signal) override
+    {
+        numFiltered++;
+        double distance = signal->getSenderPoa().pos.getPositionAt().distance(signal->getReceiverPoa().pos.getPositionAt());
+        *signal *= 1 / (1 + distance * distance);
+    }
+
+    bool neverIncreasesPower() override
+    {
+        return true;
+    }
+
+    bool dependsOnlyOnGeometry() const override
+    {
+        return true;
+    }
+
+protected:
+    int& numFiltered;
+};
+
+Signal createSignal(const Spectrum& spectrum, int senderId, Coord sender, Coord receiver)
+{
+    Signal s(spectrum);
+    s = 2;
+    s.setSenderPoa({{senderId, sender, Coord(0, 0, 0), simTime()}, {}, nullptr});
+    s.setReceiverPoa({{0, receiver, Coord(0, 0, 0), simTime()}, {}, nullptr});
+    return s;
+}
+
+} // namespace
+
+SCENARIO("CachingAnalogueModel", "[analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+    Spectrum spectrum({5.89e9, 5.9e9, 5.91e9});
+    int numFiltered = 0;
+    const double expected = 2.0 / (1 + 10 * 10);
+
+    GIVEN("a cache with a tolerance of 1 m")
+    {
+        CachingAnalogueModel cam(&dc, std::unique_ptr<AnalogueModel>(new CountingPathlossModel(&dc, numFiltered)), 1, 10);
+
+        WHEN("two frames of the same link are filtered")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("the wrapped model is asked once and both frames are attenuated alike")
+            {
+                REQUIRE(numFiltered == 1);
+                REQUIRE(cam.getNumHits() == 1);
+                REQUIRE(cam.getNumMisses() == 1);
+                REQUIRE(s1.at(1) == Approx(expected));
+                REQUIRE(s2.at(1) == s1.at(1));
+            }
+        }
+
+        WHEN("frames of different senders are filtered")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 2, Coord(0, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("each link is computed on its own")
+            {
+                REQUIRE(numFiltered == 2);
+                REQUIRE(cam.size() == 2);
+            }
+        }
+
+        WHEN("the receiver moves within the tolerance")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10.5, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("the cached attenuation is reused")
+            {
+                REQUIRE(numFiltered == 1);
+                REQUIRE(s2.at(1) == s1.at(1));
+            }
+        }
+
+        WHEN("the sender moves beyond the tolerance")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(-10, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("the attenuation is recomputed")
+            {
+                REQUIRE(numFiltered == 2);
+                REQUIRE(s2.at(1) == Approx(2.0 / (1 + 20 * 20)));
+            }
+        }
+
+        WHEN("the model is applied lazily, as with thresholding")
+        {
+            AnalogueModelList thresholding;
+            thresholding.push_back(std::unique_ptr<AnalogueModel>(new CachingAnalogueModel(&dc, std::unique_ptr<AnalogueModel>(new CountingPathlossModel(&dc, numFiltered)), 1, 10)));
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            s1.setAnalogueModelList(&thresholding);
+            s2.setAnalogueModelList(&thresholding);
+            s1.applyAllAnalogueModels();
+            s2.applyAllAnalogueModels();
+            THEN("later frames of the link are answered from the cache")
+            {
+                REQUIRE(numFiltered == 1);
+                REQUIRE(s1.at(1) == Approx(expected));
+                REQUIRE(s2.at(1) == s1.at(1));
+            }
+        }
+
+        WHEN("frames are filtered in a batch")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s3 = createSignal(spectrum, 2, Coord(0, 0), Coord(10, 0));
+            cam.filterSignals({&s2, &s3});
+            THEN("only links missing from the cache are passed on")
+            {
+                REQUIRE(numFiltered == 2);
+                REQUIRE(s2.at(1) == s1.at(1));
+                REQUIRE(s3.at(1) == Approx(expected));
+            }
+        }
+    }
+
+    GIVEN("a cache storing attenuations in fixed point dBm")
+    {
+        CachingAnalogueModel cam(&dc, std::unique_ptr<AnalogueModel>(new CountingPathlossModel(&dc, numFiltered)), 1, 10, SignalPrecision::FixedPointDb);
+
+        WHEN("two frames of the same link are filtered")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("both frames are attenuated alike by the rounded attenuation")
+            {
+                REQUIRE(numFiltered == 1);
+                REQUIRE(s2.at(1) == s1.at(1));
+                REQUIRE(s1.at(1) != expected);
+                REQUIRE(std::abs(10 * std::log10(s1.at(1) / expected)) <= 1.0 / 256 + 1e-9);
+            }
+        }
+    }
+
+    GIVEN("a cache with a timeout of 0 s")
+    {
+        CachingAnalogueModel cam(&dc, std::unique_ptr<AnalogueModel>(new CountingPathlossModel(&dc, numFiltered)), 1, 0);
+
+        WHEN("two frames of the same link are filtered")
+        {
+            Signal s1 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            Signal s2 = createSignal(spectrum, 1, Coord(0, 0), Coord(10, 0));
+            cam.filterSignal(&s1);
+            cam.filterSignal(&s2);
+            THEN("the first attenuation has expired by the second lookup")
+            {
+                REQUIRE(numFiltered == 2);
+                REQUIRE(cam.getNumEvictions() == 1);
+                REQUIRE(cam.size() == 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,357 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <random>
+#include <set>
+
+#include "veins/base/phyLayer/ChannelInfo.h"
+#include "testutils/Simulation.h"
+
+using namespace veins;
+
+namespace {
+
+/**
+ * Keeps track of which TrackedAirFrames have been deleted.
+ */
+struct Deletions {
+    std::set<const AirFrame*> deleted;
+    size_t numAlive = 0;
+
+    bool isDeleted(const AirFrame* frame) const
+    {
+        return deleted.count(frame) > 0;
+    }
+};
+
+/**
+ * AirFrame which notes when ChannelInfo deletes it.
+ */
+class TrackedAirFrame : public AirFrame {
+public:
+    TrackedAirFrame(Deletions& deletions, simtime_t duration)
+        : deletions(deletions)
+    {
+        // the memory of a deleted AirFrame may be reused
+        deletions.deleted.erase(this);
+        deletions.numAlive++;
+        setDuration(duration);
+    }
+    ~TrackedAirFrame() override
+    {
+        deletions.deleted.insert(this);
+        deletions.numAlive--;
+    }
+
+private:
+    Deletions& deletions;
+};
+
+/**
+ * Straightforward model of ChannelInfo: an inactive AirFrame is kept as long as it intersects with an active AirFrame or ends at or after the record start time.
+ */
+class ReferenceChannel {
+public:
+    struct Frame {
+        simtime_t start;
+        simtime_t end;
+        AirFrame* frame;
+        bool active;
+    };
+
+    void add(AirFrame* frame, simtime_t start)
+    {
+        frames.push_back({start, start + frame->getDuration(), frame, true});
+    }
+
+    void remove(AirFrame* frame)
+    {
+        for (auto& f : frames) {
+            if (f.frame == frame) f.active = false;
+        }
+        clean();
+    }
+
+    void setRecordStartTime(simtime_t start)
+    {
+        recordStartTime = start;
+        clean();
+    }
+
+    std::set<AirFrame*> intersecting(simtime_t from, simtime_t to) const
+    {
+        std::set<AirFrame*> result;
+        for (const auto& f : frames) {
+            if (f.end >= from && f.start <= to) result.insert(f.frame);
+        }
+        return result;
+    }
+
+    bool empty() const
+    {
+        return frames.empty();
+    }
+
+    std::vector<Frame> frames;
+
+private:
+    void clean()
+    {
+        auto unneeded = [this](const Frame& f) {
+            if (f.active) return false;
+            if (recordStartTime > -1 && recordStartTime <= f.end) return false;
+            for (const auto& other : frames) {
+                if (other.active && f.end >= other.start && f.start <= other.end) return false;
+            }
+            return true;
+        };
+        frames.erase(std::remove_if(frames.begin(), frames.end(), unneeded), frames.end());
+    }
+
+    simtime_t recordStartTime = -1;
+};
+
+std::set<AirFrame*> getAirFrames(const ChannelInfo& channelInfo, simtime_t from, simtime_t to)
+{
+    ChannelInfo::AirFrameVector airFrames;
+    channelInfo.getAirFrames(from, to, airFrames);
+    std::set<AirFrame*> result(airFrames.begin(), airFrames.end());
+    REQUIRE(result.size() == airFrames.size());
+    return result;
+}
+
+} // namespace
+
+SCENARIO("ChannelInfo", "[phyLayer]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    Deletions deletions;
+
+    GIVEN("A long AirFrame from 0 to 10 and short AirFrames from 1 to 2 and from 3 to 4")
+    {
+        ChannelInfo channelInfo;
+        auto longFrame = new TrackedAirFrame(deletions, 10);
+        auto first = new TrackedAirFrame(deletions, 1);
+        auto second = new TrackedAirFrame(deletions, 1);
+        channelInfo.addAirFrame(longFrame, 0);
+        channelInfo.addAirFrame(first, 1);
+        channelInfo.removeAirFrame(first);
+        channelInfo.addAirFrame(second, 3);
+        channelInfo.removeAirFrame(second);
+
+        THEN("the short AirFrames are kept while the long one is active")
+        {
+            REQUIRE(deletions.numAlive == 3);
+            REQUIRE(getAirFrames(channelInfo, 0, 10) == std::set<AirFrame*>({longFrame, first, second}));
+            REQUIRE(getAirFrames(channelInfo, 2, 2) == std::set<AirFrame*>({longFrame, first}));
+            REQUIRE(getAirFrames(channelInfo, 2.5, 2.5) == std::set<AirFrame*>({longFrame}));
+            REQUIRE(getAirFrames(channelInfo, 4, 10) == std::set<AirFrame*>({longFrame, second}));
+            REQUIRE(channelInfo.getEarliestInfoPoint() == 0);
+        }
+
+        WHEN("the long AirFrame ends")
+        {
+            auto later = new TrackedAirFrame(deletions, 5);
+            channelInfo.addAirFrame(later, 8);
+            channelInfo.removeAirFrame(longFrame);
+
+            THEN("only the AirFrames intersecting the remaining active one are kept")
+            {
+                REQUIRE(getAirFrames(channelInfo, 0, 13) == std::set<AirFrame*>({longFrame, later}));
+                REQUIRE(channelInfo.getEarliestInfoPoint() == 0);
+                REQUIRE(!deletions.isDeleted(longFrame));
+                REQUIRE(!deletions.isDeleted(later));
+            }
+
+            WHEN("the last AirFrame ends")
+            {
+                channelInfo.removeAirFrame(later);
+
+                THEN("the channel is empty and all AirFrames have been deleted")
+                {
+                    REQUIRE(channelInfo.isChannelEmpty());
+                    REQUIRE(channelInfo.getEarliestInfoPoint() == -1);
+                    REQUIRE(deletions.numAlive == 0);
+                }
+            }
+        }
+
+        WHEN("ChannelInfo records from 3 on")
+        {
+            channelInfo.startRecording(3);
+            channelInfo.removeAirFrame(longFrame);
+
+            THEN("the AirFrames ending before 3 are deleted")
+            {
+                REQUIRE(!channelInfo.isChannelEmpty());
+                REQUIRE(getAirFrames(channelInfo, 0, 10) == std::set<AirFrame*>({longFrame, second}));
+                REQUIRE(deletions.deleted == std::set<const AirFrame*>({first}));
+            }
+
+            WHEN("ChannelInfo stops recording")
+            {
+                channelInfo.stopRecording();
+
+                THEN("all AirFrames are deleted")
+                {
+                    REQUIRE(channelInfo.isChannelEmpty());
+                    REQUIRE(deletions.numAlive == 0);
+                }
+            }
+        }
+    }
+
+    GIVEN("An AirFrame from 0 to 10 which is released right away")
+    {
+        ChannelInfo channelInfo;
+        auto released = new TrackedAirFrame(deletions, 10);
+        channelInfo.addAirFrame(released, 0);
+        channelInfo.releaseAirFrame(released);
+
+        THEN("it is kept until its end")
+        {
+            REQUIRE(!channelInfo.isChannelEmpty());
+            REQUIRE(getAirFrames(channelInfo, 5, 5) == std::set<AirFrame*>({released}));
+        }
+
+        WHEN("an AirFrame starts at 5 and another one at 10")
+        {
+            auto first = new TrackedAirFrame(deletions, 1);
+            channelInfo.addAirFrame(first, 5);
+            channelInfo.removeAirFrame(first);
+            auto second = new TrackedAirFrame(deletions, 1);
+            channelInfo.addAirFrame(second, 10);
+
+            THEN("the released AirFrame is discarded once it ended")
+            {
+                REQUIRE(getAirFrames(channelInfo, 0, 10) == std::set<AirFrame*>({second}));
+                REQUIRE(channelInfo.getEarliestInfoPoint() == 10);
+                REQUIRE(deletions.isDeleted(released));
+                REQUIRE(deletions.isDeleted(first));
+            }
+        }
+
+        WHEN("an AirFrame from 8 to 20 is active at its end")
+        {
+            auto longFrame = new TrackedAirFrame(deletions, 12);
+            channelInfo.addAirFrame(longFrame, 8);
+            auto later = new TrackedAirFrame(deletions, 1);
+            channelInfo.addAirFrame(later, 15);
+
+            THEN("the released AirFrame is kept as long as it intersects with the active one")
+            {
+                REQUIRE(getAirFrames(channelInfo, 8, 15) == std::set<AirFrame*>({released, longFrame, later}));
+                channelInfo.removeAirFrame(later);
+                channelInfo.removeAirFrame(longFrame);
+                REQUIRE(channelInfo.isChannelEmpty());
+                REQUIRE(deletions.numAlive == 0);
+            }
+        }
+    }
+
+    GIVEN("Random traffic")
+    {
+        std::mt19937 rng(GENERATE(1, 2, 3));
+        std::uniform_int_distribution<int> interArrival(0, 3);
+        std::uniform_int_distribution<int> duration(0, 40);
+        std::uniform_int_distribution<int> action(0, 19);
+
+        ChannelInfo channelInfo;
+        ReferenceChannel reference;
+        // AirFrames by their end, and whether they have been released
+        std::multimap<simtime_t, std::pair<AirFrame*, bool>> ends;
+        simtime_t now = 0;
+
+        THEN("ChannelInfo keeps and returns the same AirFrames as the straightforward model")
+        {
+            for (int i = 0; i < 2000; ++i) {
+                now += interArrival(rng);
+
+                // AirFrames ending until now are removed before new ones are added
+                while (!ends.empty() && ends.begin()->first <= now) {
+                    AirFrame* frame = ends.begin()->second.first;
+                    if (!ends.begin()->second.second) {
+                        channelInfo.removeAirFrame(frame);
+                    }
+                    reference.remove(frame);
+                    ends.erase(ends.begin());
+                }
+
+                int a = action(rng);
+                if (a == 0) {
+                    channelInfo.startRecording(now);
+                    reference.setRecordStartTime(now);
+                }
+                else if (a == 1) {
+                    channelInfo.stopRecording();
+                    reference.setRecordStartTime(-1);
+                }
+
+                auto frame = new TrackedAirFrame(deletions, duration(rng));
+                channelInfo.addAirFrame(frame, now);
+                reference.add(frame, now);
+                // released AirFrames are not removed, but are needed as if they were removed at their end
+                bool release = a >= 2 && a < 6;
+                if (release) {
+                    channelInfo.releaseAirFrame(frame);
+                }
+                ends.emplace(now + frame->getDuration(), std::make_pair(frame, release));
+
+                // compare queries for the interval of every active AirFrame up to now
+                for (const auto& f : reference.frames) {
+                    if (!f.active) continue;
+                    REQUIRE(getAirFrames(channelInfo, f.start, now) == reference.intersecting(f.start, now));
+                    REQUIRE(getAirFrames(channelInfo, now, now) == reference.intersecting(now, now));
+                }
+                REQUIRE(channelInfo.isChannelEmpty() == reference.empty());
+                REQUIRE(channelInfo.getEarliestInfoPoint() == reference.frames.front().start);
+
+                // unneeded AirFrames are never returned, but only deleted eventually
+                for (const auto& f : reference.frames) {
+                    REQUIRE(!deletions.isDeleted(f.frame));
+                }
+            }
+
+            while (!ends.empty()) {
+                if (!ends.begin()->second.second) {
+                    channelInfo.removeAirFrame(ends.begin()->second.first);
+                }
+                reference.remove(ends.begin()->second.first);
+                ends.erase(ends.begin());
+            }
+            channelInfo.stopRecording();
+            reference.setRecordStartTime(-1);
+
+            // a later AirFrame tells ChannelInfo that all released AirFrames have ended
+            auto last = new TrackedAirFrame(deletions, 0);
+            channelInfo.addAirFrame(last, now + 100);
+            REQUIRE(getAirFrames(channelInfo, 0, now + 100) == std::set<AirFrame*>({last}));
+            channelInfo.removeAirFrame(last);
+            REQUIRE(channelInfo.isChannelEmpty());
+            REQUIRE(reference.empty());
+            REQUIRE(deletions.numAlive == 0);
+        }
+    }
+}
@@ -0,0 +1,121 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include "veins/base/phyLayer/InterferenceTracker.h"
+#include "veins/base/toolbox/SignalUtils.h"
+#include "testutils/Simulation.h"
+#include "testutils/Component.h"
+#include "testutils/DummyAnalogueModel.h"
+
+using namespace veins;
+using AirFrameVector = DeciderToPhyInterface::AirFrameVector;
+
+SCENARIO("InterferenceTracker", "[phyLayer]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    DummyComponent dc(&ds);
+    GIVEN("A spectrum with frequencies (1,2,3,4,5,6), a signal (100,200,300,0,0,0) from 5 to 15, an identical interferer, and a list with two DummyAnalogueModels (0.1, 0.1)")
+    {
+        Spectrum spectrum({1, 2, 3, 4, 5, 6});
+
+        AnalogueModelList analogueModels;
+        analogueModels.emplace_back(make_unique<DummyAnalogueModel>(&dc, 0.1));
+        analogueModels.emplace_back(make_unique<DummyAnalogueModel>(&dc, 0.1));
+
+        Signal signal(spectrum);
+        signal.at(0) = 100;
+        signal.at(1) = 200;
+        signal.at(2) = 300;
+        signal.setDataStart(0);
+        signal.setDataEnd(2);
+        signal.setCenterFrequencyIndex(2);
+        signal.setAnalogueModelList(&analogueModels);
+        signal.setTiming(5, 10);
+
+        AirFrame signalFrame;
+        signalFrame.setSignal(signal);
+        AirFrame interfererFrame;
+        interfererFrame.setSignal(signal);
+
+        InterferenceTracker tracker;
+
+        WHEN("both signals perfectly overlap")
+        {
+            tracker.addAirFrame(&signalFrame, 5);
+            tracker.addAirFrame(&interfererFrame, 5);
+
+            THEN("all AnalogueModels are applied right away")
+            {
+                REQUIRE(signalFrame.getSignal().getNumAnalogueModelsApplied() == 2);
+                REQUIRE(interfererFrame.getSignal().getNumAnalogueModelsApplied() == 2);
+            }
+            THEN("min SINR is 0.5, just like SignalUtils computes it")
+            {
+                double min = tracker.getMinSINR(5, 15, &signalFrame, 1);
+                REQUIRE(min == 0.5);
+
+                AirFrameVector airFrames = {&signalFrame, &interfererFrame};
+                REQUIRE(SignalUtils::getMinSINR(5, 15, &signalFrame, airFrames, 1) == min);
+            }
+            THEN("the summed channel power is 2 at frequency 1")
+            {
+                REQUIRE(tracker.isChannelPowerBelowThreshold(6, 1, 2.5));
+                REQUIRE_FALSE(tracker.isChannelPowerBelowThreshold(6, 1, 1.5));
+                REQUIRE(tracker.isChannelPowerBelowThreshold(6, 1, 1.5, &signalFrame));
+            }
+            THEN("the channel is free once both signals ended")
+            {
+                REQUIRE(tracker.isChannelPowerBelowThreshold(15, 1, 0.001));
+            }
+        }
+        WHEN("the interferer ends when the signal starts")
+        {
+            interfererFrame.getSignal().setTiming(0, 5);
+            tracker.addAirFrame(&interfererFrame, 0);
+            tracker.addAirFrame(&signalFrame, 5);
+            tracker.removeAirFrame(&interfererFrame, 5);
+
+            THEN("min SINR is 1.0")
+            {
+                REQUIRE(tracker.getMinSINR(5, 15, &signalFrame, 1) == 1.0);
+            }
+        }
+        WHEN("the interferer only overlaps for half of the time")
+        {
+            tracker.addAirFrame(&signalFrame, 5);
+            interfererFrame.getSignal().setTiming(7.5, 5);
+            tracker.addAirFrame(&interfererFrame, 7.5);
+
+            THEN("min SINR is 0.5")
+            {
+                REQUIRE(tracker.getMinSINR(5, 15, &signalFrame, 1) == 0.5);
+            }
+            THEN("the interval before the interferer starts is free of interference")
+            {
+                REQUIRE(tracker.getMinSINR(5, 7.5, &signalFrame, 1) == 1.0);
+            }
+        }
+    }
+}
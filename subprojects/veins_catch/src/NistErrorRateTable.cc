@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include "veins/modules/phy/NistErrorRate.h"
+#include "veins/modules/phy/NistErrorRateTable.h"
+#include "veins/modules/utility/Consts80211p.h"
+
+using namespace veins;
+
+SCENARIO("NistErrorRateTable", "[phy]")
+{
+    const std::vector<MCS> allMcs = {MCS::ofdm_bpsk_r_1_2, MCS::ofdm_bpsk_r_3_4, MCS::ofdm_qpsk_r_1_2, MCS::ofdm_qpsk_r_3_4, MCS::ofdm_qam16_r_1_2, MCS::ofdm_qam16_r_3_4, MCS::ofdm_qam64_r_2_3, MCS::ofdm_qam64_r_3_4};
+
+    const double maxError = GENERATE(1e-3, 1e-6);
+
+    GIVEN("Tables for a maximal error of 1e-3 or 1e-6")
+    {
+        auto table = NistErrorRateTable::get(maxError);
+
+        THEN("the same tables are shared")
+        {
+            REQUIRE(NistErrorRateTable::get(maxError) == table);
+        }
+
+        WHEN("comparing chunk success rates to the analytic ones over the whole SNR range")
+        {
+            std::mt19937 rng(23);
+            std::uniform_real_distribution<double> snrDb(-15, 55);
+            const std::vector<uint32_t> lengths = {1, PHY_HDR_PLCPSIGNAL_LENGTH, 8 * 50 + 38, 8 * 500 + 38, 8 * 2304 + 38, 65536};
+
+            double maxDeviation = 0;
+            for (auto mcs : allMcs) {
+                unsigned int datarate = getOfdmDatarate(mcs, BANDWIDTH_11P);
+                for (int i = 0; i < 20000; ++i) {
+                    double snr = std::pow(10.0, snrDb(rng) / 10);
+                    for (auto nbits : lengths) {
+                        double exact = NistErrorRate::getChunkSuccessRate(datarate, BANDWIDTH_11P, snr, nbits);
+                        double approx = table->getChunkSuccessRate(datarate, BANDWIDTH_11P, snr, nbits);
+                        maxDeviation = std::max(maxDeviation, std::abs(exact - approx));
+                    }
+                }
+            }
+
+            THEN("they deviate by no more than the error bound")
+            {
+                INFO("maximal deviation: " << maxDeviation);
+                REQUIRE(maxDeviation <= maxError);
+            }
+        }
+
+        WHEN("looking up SNRs beyond the table and chunks longer than the error bound covers")
+        {
+            unsigned int datarate = getOfdmDatarate(MCS::ofdm_qpsk_r_1_2, BANDWIDTH_11P);
+
+            THEN("the analytic results are returned")
+            {
+                for (double snr : {0.0, 0.05, 1e6}) {
+                    REQUIRE(table->getChunkSuccessRate(datarate, BANDWIDTH_11P, snr, 400) == NistErrorRate::getChunkSuccessRate(datarate, BANDWIDTH_11P, snr, 400));
+                }
+                REQUIRE(table->getChunkSuccessRate(datarate, BANDWIDTH_11P, 10, 100000) == NistErrorRate::getChunkSuccessRate(datarate, BANDWIDTH_11P, 10, 100000));
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include "veins/base/connectionManager/RangeMask.h"
+#include "veins/base/utils/Simd.h"
+
+using namespace veins;
+
+namespace {
+
+RangeMask computeRangeMaskWith(simd::InstructionSet instructionSet, const std::vector<double>& x, const std::vector<double>& y, const std::vector<double>& z, double maxDistSquared)
+{
+    auto previous = simd::getInstructionSet();
+    simd::setInstructionSet(instructionSet);
+    RangeMask mask;
+    computeRangeMask(0, 0, 0, x.data(), y.data(), z.data(), x.size(), maxDistSquared, mask);
+    simd::setInstructionSet(previous);
+    return mask;
+}
+
+} // namespace
+
+SCENARIO("RangeMask", "[connectionManager]")
+{
+    GIVEN("70 positions along the x axis, spaced 1 m apart, starting at 0.5 m")
+    {
+        std::vector<double> x;
+        std::vector<double> y(70, 0);
+        std::vector<double> z(70, 0);
+        for (int i = 0; i < 70; ++i) {
+            x.push_back(0.5 + i);
+        }
+
+        WHEN("computing which are within 66 m of the origin")
+        {
+            auto mask = computeRangeMaskWith(simd::InstructionSet::scalar, x, y, z, 66.0 * 66.0);
+
+            THEN("the mask holds two words")
+            {
+                REQUIRE(mask.size() == 2);
+            }
+
+            THEN("exactly the first 66 positions are in range")
+            {
+                for (size_t i = 0; i < 70; ++i) {
+                    REQUIRE(isInRangeMask(mask, i) == (i < 66));
+                }
+            }
+
+            THEN("SSE2 and AVX2 kernels yield the same mask")
+            {
+                REQUIRE(computeRangeMaskWith(simd::InstructionSet::sse2, x, y, z, 66.0 * 66.0) == mask);
+                REQUIRE(computeRangeMaskWith(simd::InstructionSet::avx2, x, y, z, 66.0 * 66.0) == mask);
+            }
+        }
+
+        WHEN("a position lies exactly at the maximum distance")
+        {
+            auto mask = computeRangeMaskWith(simd::InstructionSet::avx2, x, y, z, 3.5 * 3.5);
+
+            THEN("it is in range")
+            {
+                REQUIRE(isInRangeMask(mask, 3));
+                REQUIRE_FALSE(isInRangeMask(mask, 4));
+            }
+        }
+    }
+}
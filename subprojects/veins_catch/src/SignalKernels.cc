@@ -0,0 +1,125 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+
+#include "catch2/catch.hpp"
+
+#include <limits>
+
+#include "veins/base/toolbox/SignalKernels.h"
+#include "veins/base/utils/Simd.h"
+
+using namespace veins;
+
+namespace {
+
+template <typename Kernel>
+std::vector<double> applyWith(simd::InstructionSet instructionSet, std::vector<double> dst, Kernel kernel)
+{
+    auto previous = simd::getInstructionSet();
+    simd::setInstructionSet(instructionSet);
+    kernel(dst.data(), dst.size());
+    simd::setInstructionSet(previous);
+    return dst;
+}
+
+} // namespace
+
+SCENARIO("SignalKernels", "[toolbox]")
+{
+    GIVEN("two arrays of 11 power values")
+    {
+        std::vector<double> a;
+        std::vector<double> b;
+        for (int i = 0; i < 11; ++i) {
+            a.push_back(0.1 * (i + 1));
+            b.push_back(3.0 / (i + 2));
+        }
+
+        WHEN("dividing one by the other")
+        {
+            auto divide = [&b](double* dst, size_t n) { SignalKernels::divide(dst, b.data(), n); };
+            auto result = applyWith(simd::InstructionSet::scalar, a, divide);
+
+            THEN("each value is divided")
+            {
+                for (size_t i = 0; i < a.size(); ++i) {
+                    REQUIRE(result[i] == a[i] / b[i]);
+                }
+            }
+
+            THEN("SSE2 and AVX2 kernels yield the same values")
+            {
+                REQUIRE(applyWith(simd::InstructionSet::sse2, a, divide) == result);
+                REQUIRE(applyWith(simd::InstructionSet::avx2, a, divide) == result);
+            }
+        }
+
+        WHEN("adding a constant")
+        {
+            auto add = [](double* dst, size_t n) { SignalKernels::add(dst, 0.3, n); };
+            auto result = applyWith(simd::InstructionSet::scalar, a, add);
+
+            THEN("SSE2 and AVX2 kernels yield the same values")
+            {
+                for (size_t i = 0; i < a.size(); ++i) {
+                    REQUIRE(result[i] == a[i] + 0.3);
+                }
+                REQUIRE(applyWith(simd::InstructionSet::sse2, a, add) == result);
+                REQUIRE(applyWith(simd::InstructionSet::avx2, a, add) == result);
+            }
+        }
+
+        WHEN("computing the minimum SINR")
+        {
+            auto minSinrWith = [&a, &b](simd::InstructionSet instructionSet) {
+                auto previous = simd::getInstructionSet();
+                simd::setInstructionSet(instructionSet);
+                double minSinr = SignalKernels::minSinr(a.data(), b.data(), 0.5, a.size());
+                simd::setInstructionSet(previous);
+                return minSinr;
+            };
+
+            THEN("it matches the smallest quotient, regardless of the kernel")
+            {
+                REQUIRE(minSinrWith(simd::InstructionSet::scalar) == a[0] / (b[0] + 0.5));
+                REQUIRE(minSinrWith(simd::InstructionSet::sse2) == a[0] / (b[0] + 0.5));
+                REQUIRE(minSinrWith(simd::InstructionSet::avx2) == a[0] / (b[0] + 0.5));
+            }
+        }
+
+        WHEN("reducing the values")
+        {
+            THEN("min and max find the extreme values")
+            {
+                REQUIRE(SignalKernels::min(a.data(), a.size()) == a.front());
+                REQUIRE(SignalKernels::max(a.data(), a.size()) == a.back());
+            }
+
+            THEN("min and max of an empty range are infinite")
+            {
+                REQUIRE(SignalKernels::min(a.data(), 0) == std::numeric_limits<double>::infinity());
+                REQUIRE(SignalKernels::max(a.data(), 0) == -std::numeric_limits<double>::infinity());
+            }
+        }
+    }
+}
@@ -22,10 +22,14 @@
 
 #include "catch2/catch.hpp"
 
+#include <cmath>
+#include <random>
+
 #include "veins/base/phyLayer/DeciderToPhyInterface.h"
 #include "veins/base/toolbox/Spectrum.h"
 #include "veins/base/toolbox/Signal.h"
 #include "veins/base/toolbox/SignalUtils.h"
+#include "veins/base/toolbox/SignalPrecision.h"
 #include "veins/base/messages/AirFrame_m.h"
 #include "testutils/Simulation.h"
 #include "testutils/Component.h"
@@ -108,6 +112,15 @@ SCENARIO("Spectrum", "[toolbox]")
             }
         }
     }
+    GIVEN("An empty vector of frequencies")
+    {
+        Spectrum spectrum(Spectrum::Frequencies{});
+        THEN("it shares its grid with a default-constructed spectrum")
+        {
+            REQUIRE(spectrum == Spectrum());
+            REQUIRE(spectrum.getNumFreqs() == 0);
+        }
+    }
 }
 
 SCENARIO("Signal Constructors and Assignment", "[toolbox]")
@@ -1236,3 +1249,193 @@ SCENARIO("SignalUtils::getMinSINR treats signal start/end as inclusive/exclusive
         }
     }
 }
+
+SCENARIO("CompactSignalValues", "[toolbox]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    GIVEN("A spectrum with frequencies (1,2,3,4) and a signal (0,1e-12,0.5,100)")
+    {
+        Spectrum spectrum({1, 2, 3, 4});
+        Signal signal(spectrum);
+        signal.at(0) = 0;
+        signal.at(1) = 1e-12;
+        signal.at(2) = 0.5;
+        signal.at(3) = 100;
+
+        WHEN("encoding and decoding it in double precision")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::Double);
+            Signal decoded(spectrum);
+            compact.decodeInto(decoded);
+            THEN("all values are unchanged")
+            {
+                REQUIRE(compact.getNumBytes() == sizeof(CompactSignalValues));
+                for (size_t i = 0; i < 4; ++i) {
+                    REQUIRE(decoded.at(i) == signal.at(i));
+                }
+            }
+        }
+        WHEN("encoding and decoding it in single precision")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::Single);
+            Signal decoded(spectrum);
+            compact.decodeInto(decoded);
+            THEN("all values are rounded to float")
+            {
+                REQUIRE(compact.getNumBytes() == sizeof(CompactSignalValues));
+                for (size_t i = 0; i < 4; ++i) {
+                    REQUIRE(decoded.at(i) == static_cast<float>(signal.at(i)));
+                }
+            }
+        }
+        WHEN("encoding and decoding it in fixed point dBm")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::FixedPointDb);
+            Signal decoded(signal);
+            quantize(decoded, SignalPrecision::FixedPointDb);
+            THEN("zero power is kept and other values are within 1/256 dB")
+            {
+                REQUIRE(compact.getNumBytes() == sizeof(CompactSignalValues));
+                REQUIRE(decoded.at(0) == 0);
+                for (size_t i = 1; i < 4; ++i) {
+                    REQUIRE(std::abs(10 * std::log10(decoded.at(i) / signal.at(i))) <= 1.0 / 256 + 1e-9);
+                }
+            }
+        }
+        WHEN("multiplying a signal by the values encoded in single precision")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::Single);
+            Signal product(spectrum);
+            product = 2;
+            compact.multiplyInto(product);
+            THEN("each value is multiplied by the rounded value")
+            {
+                for (size_t i = 0; i < 4; ++i) {
+                    REQUIRE(product.at(i) == 2 * static_cast<double>(static_cast<float>(signal.at(i))));
+                }
+            }
+        }
+        WHEN("encoding a negative power value in fixed point dBm")
+        {
+            signal.at(0) = -1;
+            THEN("an error is raised")
+            {
+                REQUIRE_THROWS(CompactSignalValues(signal, SignalPrecision::FixedPointDb));
+            }
+        }
+        WHEN("decoding into a signal with a different number of values")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::Single);
+            Signal other(Spectrum({1, 2}));
+            THEN("an error is raised")
+            {
+                REQUIRE_THROWS(compact.decodeInto(other));
+            }
+        }
+    }
+    GIVEN("A signal with 64 values too many to be stored inline")
+    {
+        Spectrum::Frequencies freqs;
+        for (size_t i = 0; i < 64; ++i) {
+            freqs.push_back(i + 1);
+        }
+        Spectrum spectrum(freqs);
+        Signal signal(spectrum);
+        for (size_t i = 0; i < 64; ++i) {
+            signal.at(i) = 1e-3 * (i + 1);
+        }
+
+        WHEN("encoding it in each precision")
+        {
+            CompactSignalValues compactDouble(signal, SignalPrecision::Double);
+            CompactSignalValues compactSingle(signal, SignalPrecision::Single);
+            CompactSignalValues compactFixedPoint(signal, SignalPrecision::FixedPointDb);
+            THEN("the values on the heap take up a half or a quarter of the memory of double precision")
+            {
+                REQUIRE(compactDouble.getNumBytes() == sizeof(CompactSignalValues) + 64 * sizeof(double));
+                REQUIRE(compactSingle.getNumBytes() == sizeof(CompactSignalValues) + 64 * sizeof(float));
+                REQUIRE(compactFixedPoint.getNumBytes() == sizeof(CompactSignalValues) + 64 * sizeof(int16_t));
+            }
+        }
+        WHEN("copying and assigning the encoded values")
+        {
+            CompactSignalValues compact(signal, SignalPrecision::Single);
+            CompactSignalValues copy(compact);
+            CompactSignalValues assigned;
+            assigned = compact;
+            Signal decodedCopy(spectrum);
+            Signal decodedAssigned(spectrum);
+            copy.decodeInto(decodedCopy);
+            assigned.decodeInto(decodedAssigned);
+            THEN("both decode to the same values as the original")
+            {
+                for (size_t i = 0; i < 64; ++i) {
+                    REQUIRE(decodedCopy.at(i) == static_cast<float>(signal.at(i)));
+                    REQUIRE(decodedAssigned.at(i) == static_cast<float>(signal.at(i)));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("SignalUtils::getMinSINR with compact signal representations", "[toolbox]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr)); // necessary so simtime_t works
+    GIVEN("Random signals and interferers between -100 dBm and -40 dBm on a spectrum with 12 frequencies")
+    {
+        Spectrum spectrum({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12});
+        AnalogueModelList analogueModels;
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> powerDbm(-100, -40);
+        std::uniform_int_distribution<int> startTime(0, 20);
+
+        auto randomSignal = [&](simtime_t start, simtime_t duration) {
+            Signal signal(spectrum, start, duration);
+            for (size_t i = 0; i < signal.getNumValues(); ++i) {
+                signal.at(i) = std::pow(10.0, powerDbm(rng) / 10);
+            }
+            signal.setDataStart(2);
+            signal.setDataEnd(9);
+            signal.setCenterFrequencyIndex(6);
+            signal.setAnalogueModelList(&analogueModels);
+            return signal;
+        };
+        const double noise = std::pow(10.0, -98.0 / 10);
+
+        WHEN("computing the min SINR from signals rounded to each representation")
+        {
+            double maxDeviationSingle = 0;
+            double maxDeviationFixedPointDb = 0;
+            for (int run = 0; run < 200; ++run) {
+                std::vector<Signal> signals;
+                signals.push_back(randomSignal(10, 10));
+                for (int i = 0; i < 5; ++i) {
+                    signals.push_back(randomSignal(startTime(rng), 10));
+                }
+
+                auto minSinrDb = [&](SignalPrecision precision) {
+                    std::vector<std::unique_ptr<AirFrame>> frames;
+                    AirFrameVector interfererFrames;
+                    for (auto& signal : signals) {
+                        Signal rounded(signal);
+                        quantize(rounded, precision);
+                        frames.emplace_back(new AirFrame());
+                        frames.back()->setSignal(rounded);
+                        if (frames.size() > 1) interfererFrames.push_back(frames.back().get());
+                    }
+                    return 10 * std::log10(SignalUtils::getMinSINR(10, 20, frames.front().get(), interfererFrames, noise));
+                };
+
+                double exact = minSinrDb(SignalPrecision::Double);
+                maxDeviationSingle = std::max(maxDeviationSingle, std::abs(minSinrDb(SignalPrecision::Single) - exact));
+                maxDeviationFixedPointDb = std::max(maxDeviationFixedPointDb, std::abs(minSinrDb(SignalPrecision::FixedPointDb) - exact));
+            }
+            THEN("the maximal deviation from double precision is negligible")
+            {
+                WARN("maximal min SINR deviation: " << maxDeviationSingle << " dB (single), " << maxDeviationFixedPointDb << " dB (fixedPointDb)");
+                REQUIRE(maxDeviationSingle < 1e-5);
+                REQUIRE(maxDeviationFixedPointDb < 2.0 / 256);
+            }
+        }
+    }
+}
@@ -94,6 +94,17 @@ SCENARIO("SimplePathlossModel with alpha = 2", "[analogueModel]")
                 REQUIRE(s.at(1) == Approx(1.634e-9).epsilon(0.001));
             }
         }
+
+        WHEN("the receiver is at the distance getDistanceForAttenuation returns for an attenuation of 1e-8")
+        {
+            double distance = spm.getDistanceForAttenuation(1e-8, centerFreq);
+            s.setReceiverPoa({createDummyAntennaPosition(Coord(distance, 0, 2)), {}, nullptr});
+            THEN("SimplePathlossModel drops power from 1 to 1e-8")
+            {
+                spm.filterSignal(&s);
+                REQUIRE(s.at(1) == Approx(1e-8).epsilon(0.001));
+            }
+        }
     }
 }
 
@@ -150,5 +161,62 @@ SCENARIO("SimplePathlossModel with alpha = 2.2", "[analogueModel]")
                 REQUIRE(s.at(1) == Approx(6.5090e-10).epsilon(0.001));
             }
         }
+
+        WHEN("the receiver is at the distance getDistanceForAttenuation returns for an attenuation of 1e-8")
+        {
+            double distance = spm.getDistanceForAttenuation(1e-8, centerFreq);
+            s.setReceiverPoa({createDummyAntennaPosition(Coord(distance, 0, 2)), {}, nullptr});
+            THEN("SimplePathlossModel drops power from 1 to 1e-8")
+            {
+                spm.filterSignal(&s);
+                REQUIRE(s.at(1) == Approx(1e-8).epsilon(0.001));
+            }
+        }
+    }
+}
+
+SCENARIO("SimplePathlossModel filtering several signals at once", "[analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+    double centerFreq = 5.9e9;
+    std::vector<double> freqs = {centerFreq - 5e6, centerFreq, centerFreq + 5e6};
+    Spectrum spec(freqs);
+    SimplePathlossModel spm(&dc, 2.2, false, {0, 0, 0});
+
+    GIVEN("Signals with powerlevel 1 sent from (0, 0), (0.5, 0), (50, 0), and (300, 0) to (0, 0)")
+    {
+        std::vector<Signal> batched;
+        for (double x : {0.0, 0.5, 50.0, 300.0}) {
+            Signal s(spec);
+            s = 1;
+            s.setSenderPoa({createDummyAntennaPosition(Coord(x, 0, 2)), {}, nullptr});
+            s.setReceiverPoa({createDummyAntennaPosition(Coord(0, 0, 2)), {}, nullptr});
+            batched.push_back(s);
+        }
+        std::vector<Signal> single = batched;
+
+        WHEN("filtering them in one batch and one by one")
+        {
+            std::vector<Signal*> signals;
+            for (auto& s : batched) {
+                signals.push_back(&s);
+            }
+            spm.filterSignals(signals);
+            for (auto& s : single) {
+                spm.filterSignal(&s);
+            }
+
+            THEN("both yield exactly the same power levels")
+            {
+                for (size_t i = 0; i < batched.size(); ++i) {
+                    for (size_t j = 0; j < freqs.size(); ++j) {
+                        REQUIRE(batched[i].at(j) == single[i].at(j));
+                    }
+                }
+                REQUIRE(batched[0].at(1) == 1);
+                REQUIRE(batched[3].at(1) < 1e-9);
+            }
+        }
     }
 }
@@ -0,0 +1,129 @@
+//
+// Copyright (C) 2026 agent <agent@local>
+//
+// Documentation for these modules is at http://veins.car2x.org/
+//
+// SPDX-License-Identifier: GPL-2.0-or-later
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation; either version 2 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+//
+
+#include "catch2/catch.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "veins/modules/phy/TableErrorModel80211p.h"
+
+using namespace veins;
+
+namespace {
+
+double dB2mW(double dB)
+{
+    return std::pow(10.0, dB / 10);
+}
+
+} // namespace
+
+SCENARIO("TableErrorModel80211p", "[phy]")
+{
+    GIVEN("PER curves for 3 and 6 Mbit/s measured for 1000 bit chunks")
+    {
+        std::istringstream csv(
+            "datarate,sinr_db,per\n"
+            "# 3 Mbit/s\n"
+            "3000000,4.0,0.1\n"
+            "3000000,2.0,0.5\n"
+            "\n"
+            "6000000, 5.0, 0.9\n"
+            "6000000, 9.0, 0.0\n");
+        TableErrorModel80211p model(csv, 1000);
+
+        THEN("PERs are interpolated linearly in dB and kept constant beyond the curve")
+        {
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(2.0), 1000}) == Approx(0.5));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(3.0), 1000}) == Approx(0.7));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(4.0), 1000}) == Approx(0.9));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(-20.0), 1000}) == Approx(0.5));
+            REQUIRE(model.getChunkSuccessRate({3000000, 0, 1000}) == Approx(0.5));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(30.0), 1000}) == Approx(0.9));
+            REQUIRE(model.getChunkSuccessRate({6000000, dB2mW(8.0), 1000}) == Approx(0.775));
+            REQUIRE(model.getChunkSuccessRate({6000000, dB2mW(10.0), 1000}) == 1);
+        }
+
+        THEN("success rates scale with the chunk length")
+        {
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(2.0), 2000}) == Approx(0.25));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(2.0), 500}) == Approx(std::sqrt(0.5)));
+            REQUIRE(model.getChunkSuccessRate({3000000, dB2mW(2.0), 0}) == 1);
+        }
+
+        THEN("evaluating several chunks at once yields the same success rates")
+        {
+            std::vector<ErrorModel80211p::Chunk> chunks = {{6000000, dB2mW(6.5), 4000}, {3000000, dB2mW(3.3), 24}, {3000000, dB2mW(1.0), 4000}, {6000000, dB2mW(7.5), 24}};
+            std::vector<double> successRates;
+            model.getChunkSuccessRates(chunks, successRates);
+            REQUIRE(successRates.size() == chunks.size());
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                REQUIRE(successRates[i] == model.getChunkSuccessRate(chunks[i]));
+            }
+        }
+
+        THEN("datarates without a curve are rejected")
+        {
+            REQUIRE_THROWS(model.getChunkSuccessRate({12000000, dB2mW(5.0), 1000}));
+        }
+    }
+
+    GIVEN("PER curves in a CSV file")
+    {
+        const std::string fileName = "TableErrorModel80211p.test.csv";
+        {
+            std::ofstream csv(fileName);
+            csv << "3000000,2.0,0.5\n3000000,4.0,0.1\n";
+        }
+
+        THEN("the file is read only once per reference length and its curves are shared")
+        {
+            auto table = TableErrorModel80211p::getTable(fileName, 1000);
+            REQUIRE(TableErrorModel80211p::getTable(fileName, 500) != table);
+            std::remove(fileName.c_str());
+            REQUIRE(TableErrorModel80211p::getTable(fileName, 1000) == table);
+
+            auto model = TableErrorModel80211p::fromFile(fileName, 1000);
+            REQUIRE(model->getChunkSuccessRate({3000000, dB2mW(3.0), 1000}) == Approx(0.7));
+        }
+    }
+
+    GIVEN("Malformed PER curves")
+    {
+        THEN("they are rejected")
+        {
+            std::istringstream noCurves("datarate,sinr_db,per\n");
+            REQUIRE_THROWS(TableErrorModel80211p(noCurves, 1000));
+            std::istringstream missingField("3000000,4.0\n");
+            REQUIRE_THROWS(TableErrorModel80211p(missingField, 1000));
+            std::istringstream invalidPer("3000000,4.0,1.5\n");
+            REQUIRE_THROWS(TableErrorModel80211p(invalidPer, 1000));
+            std::istringstream duplicatePoint("3000000,4.0,0.5\n3000000,4.0,0.4\n");
+            REQUIRE_THROWS(TableErrorModel80211p(duplicatePoint, 1000));
+            std::istringstream valid("3000000,4.0,0.5\n");
+            REQUIRE_THROWS(TableErrorModel80211p(valid, 0));
+        }
+    }
+}
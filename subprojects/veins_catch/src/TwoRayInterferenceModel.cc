@@ -23,6 +23,7 @@
 #include "catch2/catch.hpp"
 
 #include "veins/modules/analogueModel/TwoRayInterferenceModel.h"
+#include "veins/modules/utility/Consts80211p.h"
 #include "veins/base/messages/AirFrame_m.h"
 #include "testutils/Simulation.h"
 #include "testutils/AirFrame.h"
@@ -68,3 +69,55 @@ SCENARIO("TwoRayInterferenceModel", "[analogueModel]")
         }
     }
 }
+
+SCENARIO("TwoRayInterferenceModel on narrowband and wideband 802.11p signals", "[analogueModel]")
+{
+    DummySimulation ds(new cNullEnvir(0, nullptr, nullptr));
+    DummyComponent dc(&ds);
+    TwoRayInterferenceModel tri(&dc, 1.02);
+    int dummyId = -1;
+
+    GIVEN("A signal on the control channel over the spectrum of all channels and one over the control channel only")
+    {
+        // mirror the spectra PhyLayer80211p uses with and without narrowband set
+        const double cch = IEEE80211ChannelFrequencies.at(Channel::cch);
+        Spectrum::Frequencies wideFreqs;
+        for (auto& channel : IEEE80211ChannelFrequencies) {
+            wideFreqs.push_back(channel.second - 5e6);
+            wideFreqs.push_back(channel.second);
+            wideFreqs.push_back(channel.second + 5e6);
+        }
+        Signal wide{Spectrum(wideFreqs)};
+        Signal narrow{Spectrum({cch - 5e6, cch, cch + 5e6})};
+        for (Signal* s : {&wide, &narrow}) {
+            size_t center = s->getSpectrum().indexOf(cch);
+            s->at(center - 1) = 0.02;
+            s->at(center) = 0.02;
+            s->at(center + 1) = 0.02;
+            s->setDataStart(center - 1);
+            s->setDataEnd(center + 1);
+            s->setCenterFrequencyIndex(center);
+            s->setSenderPoa({{dummyId, Coord(0, 0, 1.895), Coord(0, 0, 0), simTime()}, {}, nullptr});
+            s->setReceiverPoa({{dummyId, Coord(250, 30, 1.895), Coord(0, 0, 0), simTime()}, {}, nullptr});
+        }
+
+        WHEN("both are filtered")
+        {
+            tri.filterSignal(&wide);
+            tri.filterSignal(&narrow);
+
+            THEN("the narrowband signal holds exactly the data range of the wideband signal")
+            {
+                REQUIRE(wide.getNumValues() == 15);
+                REQUIRE(narrow.getNumValues() == 3);
+                REQUIRE(narrow.getNumDataValues() == wide.getNumDataValues());
+                for (size_t i = 0; i < narrow.getNumDataValues(); ++i) {
+                    REQUIRE(narrow.dataAt(i) == wide.dataAt(i));
+                }
+                REQUIRE(narrow.getAtCenterFrequency() == wide.getAtCenterFrequency());
+                REQUIRE(narrow.getDataMin() == wide.getDataMin());
+                REQUIRE(narrow.smallerAtCenterFrequency(1e-9) == wide.smallerAtCenterFrequency(1e-9));
+            }
+        }
+    }
+}